@@ -1,3 +1,4 @@
+#include <assert.h>
 #include "binary_trees.h"
 
 /**
@@ -5,20 +6,51 @@
  * @parent: Pointer to the parent node of the node to create
  * @value: Value to put in the new node
  *
+ * The node comes from the active node pool if one was selected with
+ * node_pool_use, and from malloc otherwise.
+ *
  * Return: Pointer to the new node, or NULL on failure
  */
 
 binary_tree_t *binary_tree_node(binary_tree_t *parent, int value)
 {
-	binary_tree_t *node = (binary_tree_t *)malloc(sizeof(binary_tree_t));
+	node_pool_t *pool = node_pool_active();
+	binary_tree_t *node;
+
+	if (pool)
+		node = node_pool_alloc(pool);
+	else
+		node = (binary_tree_t *)malloc(sizeof(binary_tree_t));
 
 	if (!node)
 		return (NULL);
 
 	node->n = value;
+	node->height = 0;
+	node->color = RB_RED;
+	node->size = 1;
 	node->parent = parent;
 	node->left = NULL;
 	node->right = NULL;
 
 	return (node);
 }
+
+/**
+ * binary_tree_node_free - Releases a node created by binary_tree_node
+ * @node: Pointer to the node to release
+ *
+ * The node goes back to the free list of the active node pool if there
+ * is one, and to free otherwise. The pool the node came from, or none
+ * for a node from malloc, must be the active one.
+ */
+void binary_tree_node_free(binary_tree_t *node)
+{
+	node_pool_t *pool = node_pool_active();
+
+	assert(!pool || !node || node_pool_owns(pool, node));
+	if (pool)
+		node_pool_release(pool, node);
+	else
+		free(node);
+}
@@ -1,150 +1,85 @@
 #include "binary_trees.h"
 
-static queue_t *create_queue();
-static void enqueue(queue_t *queue, void *data);
-static void *dequeue(queue_t *queue);
-static bool is_empty(queue_t *queue);
-
 /**
  * binary_tree_levelorder -  Performs level order traversal of a binary tree.
  *
  * Traverses the binary tree in level order and applies the
- * specified function to each node's data.
+ * specified function to each node's data. The queue starts on a small
+ * buffer on the stack and grows by doubling, so only O(log(n))
+ * allocations are made whatever the size of the tree.
  *
  * @tree: A pointer to the root node of the binary tree.
  * @func: A pointer to the function to be applied to each node's data.
  */
 void binary_tree_levelorder(const binary_tree_t *tree, void (*func)(int))
 {
-	queue_t *queue;
+	void *scratch[QUEUE_SCRATCH_SIZE];
+	const binary_tree_t *front;
+	queue_t queue;
 
 	if (!tree || !func)
 		return;
 
-	queue = create_queue();
-	enqueue(queue, (void *)tree);
+	queue_init(&queue, scratch, QUEUE_SCRATCH_SIZE);
+	queue_push(&queue, (void *)tree);
 
-	while (!is_empty(queue))
+	while (!queue_is_empty(&queue))
 	{
-
-		binary_tree_t *front = dequeue(queue);
+		front = queue_pop(&queue);
 
 		func(front->n);
 
-		if (front->left)
-			enqueue(queue, (void *)front->left);
-		if (front->right)
-			enqueue(queue, (void *)front->right);
+		if (front->left && !queue_push(&queue, (void *)front->left))
+			break;
+		if (front->right && !queue_push(&queue, (void *)front->right))
+			break;
 	}
 
-	queue->head = queue->tail = NULL;
-	free(queue);
+	queue_free(&queue);
 }
 
 /**
- * create_queue - Creates a new queue.
+ * binary_tree_levelorder_ctx - Performs level order traversal of a binary
+ * tree, with a callback that can stop it.
  *
- * Allocates memory for a new queue structure and initializes
- * it with empty values.
+ * Works like binary_tree_levelorder, but the callback receives the node
+ * and @ctx, and the traversal ends as soon as it returns nonzero.
  *
- * Return: A pointer to the newly created queue,
- * or NULL if memory allocation fails.
+ * @tree: A pointer to the root node of the binary tree.
+ * @func: A pointer to the function to call for each node, returning
+ * nonzero to stop the traversal.
+ * @ctx: A pointer passed to @func as is.
+ * Return: The number of nodes passed to @func.
  */
-static queue_t *create_queue()
+size_t binary_tree_levelorder_ctx(const binary_tree_t *tree,
+				  binary_tree_visit_t func, void *ctx)
 {
-	queue_t *queue = (queue_t *)malloc(sizeof(queue_t));
-
-	if (queue == NULL)
-	{
-		fprintf(stderr, "Memory allocation failed. Unable to create queue.\n");
-		return (NULL);
-	}
-
-	queue->head = NULL;
-	queue->tail = NULL;
+	void *scratch[QUEUE_SCRATCH_SIZE];
+	const binary_tree_t *front;
+	queue_t queue;
+	size_t count = 0;
 
-	return (queue);
-}
+	if (!tree || !func)
+		return (0);
 
-/**
- * enqueue - Adds an element to the rear of the queue.
- *
- * Allocates memory for a new node, stores the provided data in it,
- * and adds it to the rear of the queue.
- *
- * @queue: A pointer to the queue to which the element will be added.
- * @data: A pointer to the data to be stored in the new node.
- */
-static void enqueue(queue_t *queue, void *data)
-{
-	linked_list_node_t *newNode;
+	queue_init(&queue, scratch, QUEUE_SCRATCH_SIZE);
+	queue_push(&queue, (void *)tree);
 
-	newNode = (linked_list_node_t *)malloc(sizeof(linked_list_node_t));
-	if (!newNode)
+	while (!queue_is_empty(&queue))
 	{
-		fprintf(stderr, "Memory allocation failed. Unable to enqueue!\n");
-		return;
-	}
+		front = queue_pop(&queue);
 
-	newNode->data = data;
-	newNode->next = NULL;
+		count++;
+		if (func(front, ctx))
+			break;
 
-	if (!queue->tail)
-	{
-		queue->head = newNode;
-		queue->tail = newNode;
+		if (front->left && !queue_push(&queue, (void *)front->left))
+			break;
+		if (front->right && !queue_push(&queue, (void *)front->right))
+			break;
 	}
-	else
-	{
-		queue->tail->next = newNode;
-		queue->tail = newNode;
-	}
-}
 
-/**
- * dequeue -  Removes and returns the element at the front of the queue.
- *
- * Removes the element at the front of the queue,
- * frees the memory allocated for its node, and returns the data
- * stored in the removed node.
- *
- * @queue: A pointer to the queue from which the element will be removed.
- * Return: A pointer to the data of the removed element,
- * or NULL if the queue is empty.
- */
-static void *dequeue(queue_t *queue)
-{
-	linked_list_node_t *temp;
-	void *data;
-
-	if (!queue->head)
-	{
-		printf("Queue is empty. Cannot dequeue!\n");
-		return (NULL);
-	}
-
-	temp = queue->head;
-	data = temp->data;
-	queue->head = queue->head->next;
-
-	if (!queue->head)
-		queue->tail = NULL;
+	queue_free(&queue);
 
-	free(temp);
-
-	return (data);
-}
-
-/**
- * is_empty -  Checks if the queue is empty.
- *
- * Checks if the queue is empty by verifying if the head pointer is NULL.
- *
- * @queue: A pointer to the queue to be checked.
- * Return: true if the queue is empty, false otherwise.
- */
-
-static bool is_empty(queue_t *queue)
-{
-	return (!queue->head);
+	return (count);
 }
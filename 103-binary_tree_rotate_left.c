@@ -6,6 +6,7 @@
  * Rotates the specified binary tree to the left.
  * This operation assumes that the tree is right-heavy,
  * i.e., the right child of the root is present.
+ * The cached heights and sizes of the two rotated nodes are refreshed.
  *
  * @tree: A pointer to the root node of the binary tree to be rotated.
  * Return: A pointer to the new root node of the rotated binary tree.
@@ -29,5 +30,10 @@ binary_tree_t *binary_tree_rotate_left(binary_tree_t *tree)
 	right->parent = tree->parent;
 	right->left->parent = right;
 
+	avl_update_height(tree);
+	avl_update_height(right);
+	bst_update_size(tree);
+	bst_update_size(right);
+
 	return (right);
 }
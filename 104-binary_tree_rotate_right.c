@@ -6,6 +6,7 @@
  * Rotates the specified binary tree to the right.
  * This operation assumes that the tree is left-heavy,
  * i.e., the left child of the root is present.
+ * The cached heights and sizes of the two rotated nodes are refreshed.
  *
  * @tree: A pointer to the root node of the binary tree to be rotated.
  * Return: A pointer to the new root node of the rotated binary tree.
@@ -29,5 +30,10 @@ binary_tree_t *binary_tree_rotate_right(binary_tree_t *tree)
 	left->parent = tree->parent;
 	left->right->parent = left;
 
+	avl_update_height(tree);
+	avl_update_height(left);
+	bst_update_size(tree);
+	bst_update_size(left);
+
 	return (left);
 }
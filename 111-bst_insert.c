@@ -1,7 +1,5 @@
 #include "binary_trees.h"
 
-static bst_t *_bst_insert(bst_t *tree, const bst_t *new_node);
-
 /**
  * bst_insert - Inserts a new node with the given value into a binary
  * search tree (BST).
@@ -17,70 +15,55 @@ static bst_t *_bst_insert(bst_t *tree, const bst_t *new_node);
  */
 bst_t *bst_insert(bst_t **tree, int value)
 {
-	bst_t *new_node = binary_tree_node(NULL, value);
-
-	if (!tree || !new_node)
-		return (NULL);
-
-	if (bst_search(*tree, value))
-	{
-		free(new_node);
-		return (NULL);
-	}
-
-	*tree = _bst_insert(*tree, (const bst_t *)new_node);
+	bool inserted = false;
+	bst_t *node = bst_insert_or_get(tree, value, &inserted);
 
-	return (new_node);
+	return (inserted ? node : NULL);
 }
 
 /**
- * _bst_insert - Helper function to recursively insert a new node into a BST.
+ * bst_insert_or_get - Inserts a value into a BST or finds the node
+ * already holding it.
  *
- * Inserts the new node into the specified BST recursively based on its value.
+ * Descends the tree once, iteratively, remembering the link where the
+ * value belongs. A node is allocated only when the value is absent,
+ * and only the new leaf is linked into the tree. The descent only reads
+ * the tree, so finding an existing value costs no writes; the cached size
+ * of each ancestor is incremented once a new leaf has been linked.
  *
- * @tree: A pointer to the root node of the BST.
- * @new_node: A pointer to the new node to be inserted into the BST.
- * Return: A pointer to the root node of the modified BST.
+ * @tree: A pointer to a pointer to the root node of the BST.
+ * @value: The value to be inserted into the BST.
+ * @inserted: Set to true if a new node was created, false otherwise
+ * (may be NULL).
+ * Return: A pointer to the new node, or to the existing node holding
+ * @value, or NULL on failure.
  */
-static bst_t *_bst_insert(bst_t *tree, const bst_t *new_node)
+bst_t *bst_insert_or_get(bst_t **tree, int value, bool *inserted)
 {
-	if (!tree)
-		return ((bst_t *)new_node);
+	bst_t *parent = NULL, **link, *node, *top;
 
-	if (tree->n > new_node->n)
-	{
-		tree->left = _bst_insert(tree->left, new_node);
-		tree->left->parent = tree;
-	}
+	if (inserted)
+		*inserted = false;
+	if (!tree)
+		return (NULL);
 
-	if (tree->n < new_node->n)
+	link = tree;
+	top = *tree ? (*tree)->parent : NULL;
+	while (*link && (*link)->n != value)
 	{
-		tree->right = _bst_insert(tree->right, new_node);
-		tree->right->parent = tree;
+		parent = *link;
+		link = value < parent->n ? &parent->left : &parent->right;
 	}
+	if (*link)
+		return (*link);
 
-	return (tree);
-}
-
-/**
- * bst_search - Helper function to search for a value in a BST.
- *
- * Searches for the specified value in the BST recursively.
- *
- * @tree: A pointer to the root node of the BST.
- * @value: The value to search for in the BST.
- * Return: A pointer to the node containing the value if found,
- * NULL otherwise.
- */
-bst_t *bst_search(const bst_t *tree, int value)
-{
-	if (!tree)
+	*link = binary_tree_node(parent, value);
+	if (!*link)
 		return (NULL);
+	if (inserted)
+		*inserted = true;
+	for (node = parent; node != top; node = node->parent)
+		node->size++;
 
-	if (tree->n > value)
-		return (bst_search(tree->left, value));
-	if (tree->n < value)
-		return (bst_search(tree->right, value));
-
-	return ((bst_t *)tree);
+	return (*link);
 }
@@ -8,6 +8,7 @@ static bst_t *bst_min(bst_t *root);
  *
  * Removes the node with the given value from the BST rooted at 'root'.
  * If the value does not exist in the BST, no changes are made.
+ * The cached sizes are recomputed on the way back up.
  *
  * @root: A pointer to the root node of the BST.
  * @value: The value to be removed from the BST.
@@ -39,7 +40,7 @@ bst_t *bst_remove(bst_t *root, int value)
 			root->left = NULL;
 			root->right = NULL;
 			root->parent = NULL;
-			free(root);
+			binary_tree_node_free(root);
 			return (tmp);
 		}
 		else if (!root->right)
@@ -48,7 +49,7 @@ bst_t *bst_remove(bst_t *root, int value)
 			root->left = NULL;
 			root->right = NULL;
 			root->parent = NULL;
-			free(root);
+			binary_tree_node_free(root);
 			return (tmp);
 		}
 
@@ -58,6 +59,7 @@ bst_t *bst_remove(bst_t *root, int value)
 		if (root->right)
 			root->right->parent = root;
 	}
+	bst_update_size(root);
 	return (root);
 }
 
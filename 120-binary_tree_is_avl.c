@@ -1,7 +1,49 @@
 #include "binary_trees.h"
 
-static int height_and_balance(const binary_tree_t *tree, bool *is_balanced);
-static int _binary_tree_is_bst(const binary_tree_t *tree, int min, int max);
+/* Frames kept on the stack before the walk allocates */
+#define AVL_SCRATCH_SIZE 64
+
+/**
+ * struct avl_frame_s - Node waiting in the validation walk
+ *
+ * @node: Pointer to the node
+ * @lo: Pointer to the nearest ancestor @node must be greater than, or NULL
+ * @hi: Pointer to the nearest ancestor @node must be less than, or NULL
+ * @left_height: Height of the left subtree, once it is done
+ * @state: 0 before the left subtree, 1 before the right one, 2 after both
+ */
+typedef struct avl_frame_s
+{
+	const binary_tree_t *node;
+	const binary_tree_t *lo;
+	const binary_tree_t *hi;
+	int left_height;
+	int state;
+} avl_frame_t;
+
+/**
+ * struct avl_walk_s - State of the validation walk
+ *
+ * @stack: Frames of the nodes being checked, the current one on top
+ * @size: Number of frames in @stack
+ * @capacity: Number of frames @stack can hold
+ * @scratch: Buffer @stack started on, which is never freed
+ * @last: Height of the subtree that was just finished
+ * @offender: First node found out of order or out of balance, or NULL
+ */
+typedef struct avl_walk_s
+{
+	avl_frame_t *stack;
+	size_t size;
+	size_t capacity;
+	avl_frame_t *scratch;
+	int last;
+	const binary_tree_t *offender;
+} avl_walk_t;
+
+static int descend(avl_walk_t *walk, bool right);
+static bool climb(avl_walk_t *walk);
+static bool push(avl_walk_t *walk);
 
 /**
  * binary_tree_is_avl - Checks if a binary tree is an AVL tree.
@@ -16,88 +58,156 @@ static int _binary_tree_is_bst(const binary_tree_t *tree, int min, int max);
  */
 int binary_tree_is_avl(const binary_tree_t *tree)
 {
-	bool is_balanced;
-
-	if (!tree)
-		return (0);
-
-	is_balanced = true;
-	height_and_balance(tree, &is_balanced);
+	return (binary_tree_check_avl(tree, NULL));
+}
 
-	return (is_balanced && binary_tree_is_bst(tree));
+/**
+ * binary_tree_check_avl - Checks if a binary tree is an AVL tree and finds
+ * the first node breaking the rules.
+ *
+ * The tree is walked once in post-order with an explicit stack, so the
+ * check costs O(n) whatever the shape of the tree and cannot overflow the
+ * call stack. On the way down, each node is compared with the two
+ * ancestors bounding its subtree; on the way up, the heights of its
+ * subtrees are compared. Neither the parent pointers nor the cached
+ * heights are trusted. The stack starts on a small buffer and grows by
+ * doubling.
+ *
+ * @tree: A pointer to the root node of the binary tree to be checked.
+ * @bad: If not NULL, receives a pointer to the first node found out of
+ * order or out of balance, or NULL if there is none.
+ * Return: 1 if the binary tree is an AVL tree, 0 otherwise (including when
+ * the stack cannot grow, in which case @bad is NULL).
+ */
+int binary_tree_check_avl(const binary_tree_t *tree, const binary_tree_t **bad)
+{
+	avl_frame_t scratch[AVL_SCRATCH_SIZE];
+	avl_walk_t walk;
+	bool valid;
+	int state;
+
+	walk.stack = scratch;
+	walk.size = 0;
+	walk.capacity = AVL_SCRATCH_SIZE;
+	walk.scratch = scratch;
+	walk.last = -1;
+	walk.offender = NULL;
+	valid = tree && push(&walk);
+	if (valid)
+	{
+		walk.stack[0].node = tree;
+		walk.stack[0].lo = walk.stack[0].hi = NULL;
+	}
+
+	while (walk.size)
+	{
+		state = walk.stack[walk.size - 1].state;
+		if (state < 2 ? descend(&walk, state == 1) < 0 : !climb(&walk))
+			break;
+	}
+
+	if (walk.stack != scratch)
+		free(walk.stack);
+	if (bad)
+		*bad = walk.offender;
+
+	return (valid && !walk.size);
 }
 
 /**
- * height_and_balance - Helper function to calculate the height and
- * balance factor of a binary tree.
+ * descend - Moves the walk down to one child of the node on top.
  *
- * Recursively calculates the height and balance factor of each node in
- * the binary tree. Updates the boolean variable 'is_balanced'
- * to indicate whether the tree is balanced.
+ * Before the left child, the node is first compared with the two
+ * ancestors bounding its subtree; before the right child, the height of
+ * the finished left subtree is recorded. The child inherits the bound on
+ * its outer side and gets the node as the bound on its inner side.
  *
- * @tree: A pointer to the root node of the binary tree.
- * @is_balanced: A pointer to a boolean variable
- * indicating whether the tree is balanced.
- * Return: The height of the binary tree.
+ * @walk: A pointer to the state of the walk.
+ * @right: false to go to the left child, true to go to the right one.
+ * Return: 1 if the child was pushed, 0 if there is no such child, or -1
+ * if the node is out of order or the stack cannot grow.
  */
-static int height_and_balance(const binary_tree_t *tree, bool *is_balanced)
+static int descend(avl_walk_t *walk, bool right)
 {
-	int left_height, right_height;
+	avl_frame_t *frame = &walk->stack[walk->size - 1];
+	const binary_tree_t *node = frame->node, *child;
 
-	if (!tree)
+	if (!right && ((frame->lo && node->n <= frame->lo->n) ||
+		       (frame->hi && node->n >= frame->hi->n)))
+	{
+		walk->offender = node;
+		return (-1);
+	}
+	if (right)
+		frame->left_height = walk->last;
+	frame->state = right ? 2 : 1;
+
+	child = right ? node->right : node->left;
+	if (!child)
+	{
+		walk->last = -1;
+		return (0);
+	}
+	if (!push(walk))
 		return (-1);
 
-	left_height = height_and_balance(tree->left, is_balanced);
-	right_height = height_and_balance(tree->right, is_balanced);
-
-	if (abs(left_height - right_height) > 1)
-		*is_balanced = false;
+	frame = &walk->stack[walk->size - 2];
+	walk->stack[walk->size - 1].node = child;
+	walk->stack[walk->size - 1].lo = right ? node : frame->lo;
+	walk->stack[walk->size - 1].hi = right ? frame->hi : node;
 
-	return (max(left_height, right_height) + 1);
+	return (1);
 }
 
 /**
- * binary_tree_is_bst - Checks if a binary tree is a binary search tree (BST).
- *
- * Determines whether the binary tree satisfies the properties
- * of a binary search tree,
- * where for each node, all elements in its left subtree are
- * less than the node's value,
- * and all elements in its right subtree are greater than the node's value.
+ * climb - Checks the balance of the node on top once both subtrees are
+ * done, and pops it.
  *
- * @tree: A pointer to the root node of the binary tree to be checked.
- * Return: 1 if the binary tree is a BST, 0 otherwise.
+ * @walk: A pointer to the state of the walk.
+ * Return: true on success, false if the node is out of balance.
  */
-int binary_tree_is_bst(const binary_tree_t *tree)
+static bool climb(avl_walk_t *walk)
 {
+	avl_frame_t *frame = &walk->stack[walk->size - 1];
 
-	if (!tree)
-		return (0);
+	if (abs(frame->left_height - walk->last) > 1)
+	{
+		walk->offender = frame->node;
+		return (false);
+	}
 
-	return (_binary_tree_is_bst(tree, INT_MIN, INT_MAX));
+	walk->last = max(frame->left_height, walk->last) + 1;
+	walk->size--;
+
+	return (true);
 }
 
 /**
- * _binary_tree_is_bst -  Helper function to recursively
- * check if a binary tree is a BST.
- *
- * Recursively checks if the binary tree satisfies the BST
- * property within the specified range.
+ * push - Pushes a blank frame on the validation stack, growing it if needed.
  *
- * @tree: A pointer to the root node of the binary tree to be checked.
- * @min: The minimum value allowed in the subtree.
- * @max: The maximum value allowed in the subtree.
- * Return: 1 if the binary tree is a BST within the
- * specified range, 0 otherwise.
+ * @walk: A pointer to the state of the walk, whose stack is moved off its
+ * scratch buffer when it grows.
+ * Return: true on success, false if the stack cannot grow.
  */
-static int _binary_tree_is_bst(const binary_tree_t *tree, int min, int max)
+static bool push(avl_walk_t *walk)
 {
-	if (!tree)
-		return (1);
-
-	if (tree->n < min || tree->n > max)
-		return (0);
-
-	return (_binary_tree_is_bst(tree->left, min, tree->n - 1) &&
-		_binary_tree_is_bst(tree->right, tree->n + 1, max));
+	avl_frame_t *grown;
+
+	if (walk->size == walk->capacity)
+	{
+		grown = malloc(sizeof(avl_frame_t) * walk->capacity * 2);
+		if (!grown)
+			return (false);
+		memcpy(grown, walk->stack, sizeof(avl_frame_t) * walk->size);
+		if (walk->stack != walk->scratch)
+			free(walk->stack);
+		walk->stack = grown;
+		walk->capacity *= 2;
+	}
+
+	walk->stack[walk->size].state = 0;
+	walk->stack[walk->size].left_height = -1;
+	walk->size++;
+
+	return (true);
 }
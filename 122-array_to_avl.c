@@ -1,5 +1,7 @@
 #include "binary_trees.h"
 
+static int compare_int(const void *a, const void *b);
+
 /**
  * array_to_avl - Creates an AVL tree from an array of integers.
  * @array: Pointer to the array of integers.
@@ -21,3 +23,58 @@ avl_t *array_to_avl(int *array, size_t size)
 
 	return (root);
 }
+
+/**
+ * array_to_avl_bulk - Creates an AVL tree from an array of integers
+ * in one pass instead of one insertion per element.
+ * @array: Pointer to the array of integers.
+ * @size: Size of the array.
+ *
+ * A copy of the array is sorted and deduplicated, then handed to
+ * sorted_array_to_avl, which builds a perfectly balanced tree in O(n).
+ * As with array_to_avl, repeated values are only stored once. The whole
+ * build costs O(n log(n)) for the sort, with no rotation at all.
+ *
+ * Return: Pointer to the root of the constructed AVL tree,
+ * or NULL on failure.
+ */
+avl_t *array_to_avl_bulk(int *array, size_t size)
+{
+	size_t i, unique;
+	int *sorted;
+	avl_t *root;
+
+	if (!array || !size)
+		return (NULL);
+
+	sorted = malloc(sizeof(int) * size);
+	if (!sorted)
+		return (NULL);
+
+	memcpy(sorted, array, sizeof(int) * size);
+	qsort(sorted, size, sizeof(int), compare_int);
+
+	for (i = 1, unique = 1; i < size; i++)
+		if (sorted[i] != sorted[unique - 1])
+			sorted[unique++] = sorted[i];
+
+	root = sorted_array_to_avl(sorted, unique);
+	free(sorted);
+
+	return (root);
+}
+
+/**
+ * compare_int - Orders two integers for qsort.
+ * @a: Pointer to the first integer.
+ * @b: Pointer to the second integer.
+ *
+ * Return: A negative value, zero or a positive value if the first integer
+ * is respectively smaller than, equal to or greater than the second.
+ */
+static int compare_int(const void *a, const void *b)
+{
+	int x = *(const int *)a, y = *(const int *)b;
+
+	return ((x > y) - (x < y));
+}
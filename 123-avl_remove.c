@@ -1,6 +1,5 @@
 #include "binary_trees.h"
 
-static avl_t *apply_rotation(avl_t *tree);
 static bst_t *bst_min(bst_t *root);
 
 /**
@@ -9,92 +8,49 @@ static bst_t *bst_min(bst_t *root);
  * @value: Value of the node to be removed.
  *
  * This function removes the node with the specified value from the AVL tree.
- * It then rebalances the tree if necessary to maintain AVL properties.
+ * A node with two children takes the value of its in-order successor, which
+ * is unlinked instead. The cached sizes of its ancestors are decremented,
+ * then the tree is retraced from the parent of the unlinked node, stopping
+ * as soon as a subtree keeps its height.
  *
  * Return: Pointer to the root of the AVL tree after removal and rebalancing.
  */
 bst_t *avl_remove(bst_t *root, int value)
 {
-	bst_t *tmp;
+	bst_t *node, *child, *parent;
 
-	if (!root)
-		return (NULL);
-	if (root->n > value)
-	{
-		root->left = avl_remove(root->left, value);
-		if (root->left)
-			root->left->parent = root;
-	}
-	else if (root->n < value)
-	{
-		root->right = avl_remove(root->right, value);
-		if (root->right)
-			root->right->parent = root;
-	}
-	else
-	{
-		if (!root->left)
-		{
-			tmp = root->right;
-			root->left = NULL;
-			root->right = NULL;
-			root->parent = NULL;
-			free(root);
-			return (tmp);
-		}
-		else if (!root->right)
-		{
-			tmp = root->left;
-			root->left = NULL;
-			root->right = NULL;
-			root->parent = NULL;
-			free(root);
-			return (tmp);
-		}
+	node = bst_search(root, value);
+	if (!node)
+		return (root);
 
-		tmp = bst_min(root->right);
-		root->n = tmp->n;
-		root->right = avl_remove(root->right, tmp->n);
-		if (root->right)
-			root->right->parent = root;
+	if (node->left && node->right)
+	{
+		child = bst_min(node->right);
+		node->n = child->n;
+		node = child;
 	}
 
-	return (apply_rotation(root));
-}
-
-/**
- * apply_rotation - Applies rotations to maintain AVL properties after removal.
- * @tree: Pointer to the root of the AVL tree.
- *
- * This function checks the balance factor of the AVL tree and
- * applies rotations
- * if necessary to maintain AVL properties after a node removal operation.
- *
- * Return: Pointer to the root of the AVL tree after applying rotations.
- */
-static avl_t *apply_rotation(avl_t *tree)
-{
-	int balance_factor = binary_tree_balance(tree);
-
-	if (balance_factor > 1 && binary_tree_balance(tree->left) >= 0)
-		return (binary_tree_rotate_right(tree));
+	child = node->left ? node->left : node->right;
+	parent = node->parent;
 
-	if (balance_factor > 1 && binary_tree_balance(tree->left) < 0)
-	{
-		tree->left = binary_tree_rotate_left(tree->left);
-		return (binary_tree_rotate_right(tree));
-	}
+	if (child)
+		child->parent = parent;
+	if (!parent)
+		root = child;
+	else if (parent->left == node)
+		parent->left = child;
+	else
+		parent->right = child;
 
-	if (balance_factor < -1 && binary_tree_balance(tree->right) <= 0)
-		return (binary_tree_rotate_left(tree));
+	node->left = NULL;
+	node->right = NULL;
+	node->parent = NULL;
+	binary_tree_node_free(node);
 
-	if (balance_factor < -1 && binary_tree_balance(tree->right) > 0)
-	{
-		tree->right = binary_tree_rotate_right(tree->right);
-		return (binary_tree_rotate_left(tree));
-	}
+	for (node = parent; node; node = node->parent)
+		node->size--;
 
-	return (tree);
+	return (avl_retrace(parent, root));
 }
 
 /**
@@ -109,8 +65,8 @@ static avl_t *apply_rotation(avl_t *tree)
  */
 static bst_t *bst_min(bst_t *root)
 {
-	if (!root->left)
-		return (root);
+	while (root->left)
+		root = root->left;
 
-	return (bst_min(root->left));
+	return (root);
 }
@@ -31,6 +31,8 @@ avl_t *sorted_array_to_avl(int *array, size_t size)
  * This function recursively constructs the AVL tree from a sorted array of
  * integers. It divides the array into halves and creates nodes from the middle
  * elements of each half, ensuring that the tree remains balanced.
+ * The cached height and size of each node are set once both children
+ * are built.
  *
  * Return: Pointer to the root of the AVL tree constructed
  * from the current subarray.
@@ -57,5 +59,8 @@ static avl_t *helper(int *array, size_t left, size_t right)
 	if (tree->right)
 		tree->right->parent = tree;
 
+	avl_update_height(tree);
+	bst_update_size(tree);
+
 	return (tree);
 }
@@ -0,0 +1,108 @@
+#include "binary_trees.h"
+
+/**
+ * avl_height - Reads the cached height of an AVL subtree.
+ * @tree: Pointer to the root node of the subtree.
+ *
+ * Return: The height stored in @tree, or -1 if @tree is NULL.
+ */
+int avl_height(const avl_t *tree)
+{
+	if (!tree)
+		return (-1);
+
+	return (tree->height);
+}
+
+/**
+ * avl_update_height - Recomputes the cached height of a node.
+ * @tree: Pointer to the node to update.
+ *
+ * The height is derived from the cached heights of the children,
+ * so it costs O(1) as long as both children are already up to date.
+ */
+void avl_update_height(avl_t *tree)
+{
+	if (!tree)
+		return;
+
+	tree->height = max(avl_height(tree->left), avl_height(tree->right)) + 1;
+}
+
+/**
+ * avl_rebalance - Restores the AVL property at a single node.
+ * @tree: Pointer to the node whose children are already balanced.
+ *
+ * This function refreshes the cached height of @tree and applies the
+ * single or double rotation required when its balance factor is out of
+ * the [-1, 1] range. The parent of @tree is relinked to the new subtree
+ * root so the caller can keep walking up through the parent pointers.
+ *
+ * Return: Pointer to the root of the rebalanced subtree.
+ */
+avl_t *avl_rebalance(avl_t *tree)
+{
+	avl_t *parent, *new_root;
+	int balance_factor;
+
+	if (!tree)
+		return (NULL);
+
+	avl_update_height(tree);
+	balance_factor = avl_height(tree->left) - avl_height(tree->right);
+	if (balance_factor >= -1 && balance_factor <= 1)
+		return (tree);
+
+	parent = tree->parent;
+	if (balance_factor > 1)
+	{
+		if (avl_height(tree->left->left) < avl_height(tree->left->right))
+			tree->left = binary_tree_rotate_left(tree->left);
+		new_root = binary_tree_rotate_right(tree);
+	}
+	else
+	{
+		if (avl_height(tree->right->right) < avl_height(tree->right->left))
+			tree->right = binary_tree_rotate_right(tree->right);
+		new_root = binary_tree_rotate_left(tree);
+	}
+
+	if (parent && parent->left == tree)
+		parent->left = new_root;
+	else if (parent)
+		parent->right = new_root;
+
+	return (new_root);
+}
+
+/**
+ * avl_retrace - Rebalances an AVL tree from a modified node up to the root.
+ * @node: Pointer to the lowest node whose subtree changed.
+ * @root: Pointer to the current root of the AVL tree.
+ *
+ * This function walks up through the parent pointers, rebalancing each
+ * node on the way. The walk stops as soon as a subtree keeps its previous
+ * height, since none of its ancestors can be affected past that point,
+ * which bounds the work of an insertion or a removal to O(log(n)).
+ *
+ * Return: Pointer to the root of the AVL tree after rebalancing.
+ */
+avl_t *avl_retrace(avl_t *node, avl_t *root)
+{
+	int old_height;
+
+	while (node)
+	{
+		old_height = node->height;
+		node = avl_rebalance(node);
+
+		if (!node->parent)
+			return (node);
+		if (node->height == old_height)
+			return (root);
+
+		node = node->parent;
+	}
+
+	return (root);
+}
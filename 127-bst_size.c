@@ -0,0 +1,30 @@
+#include "binary_trees.h"
+
+/**
+ * bst_size - Reads the cached size of a BST
+ * @tree: Pointer to the root node of the BST
+ *
+ * Return: Number of nodes in @tree, or 0 if @tree is NULL
+ */
+size_t bst_size(const bst_t *tree)
+{
+	if (!tree)
+		return (0);
+
+	return (tree->size);
+}
+
+/**
+ * bst_update_size - Recomputes the cached size of a node
+ * @tree: Pointer to the node to update
+ *
+ * The size is derived from the cached sizes of the children,
+ * so it costs O(1) as long as both children are already up to date.
+ */
+void bst_update_size(bst_t *tree)
+{
+	if (!tree)
+		return;
+
+	tree->size = bst_size(tree->left) + bst_size(tree->right) + 1;
+}
@@ -1,6 +1,5 @@
 #include "binary_trees.h"
 
-static heap_t *get_heap_empty_slot(heap_t *root);
 static heap_t *maxify_up(heap_t *tree);
 static void swap_with_right_child(binary_tree_t *parent);
 static void swap_with_left_child(binary_tree_t *parent);
@@ -13,116 +12,67 @@ static void swap_with_left_child(binary_tree_t *parent);
  * Return: Pointer to the newly inserted node
  *
  * This function inserts a new node with the given value into
- * a binary max heap. It first creates a new node and assigns
- * it the given value. If the heap is empty, the new node becomes
- * the root of the heap. Otherwise, it finds the empty slot in the
- * heap using the get_heap_empty_slot function and inserts the new
- * node at that position. After insertion, it restores the max heap
- * property by calling the maxify_up function on the newly inserted node.
+ * a binary max heap. The heap is wrapped in a heap handle so the
+ * insertion goes through heap_handle_insert. Callers that keep a
+ * heap_handle_t around avoid the O(n) size count done here.
  */
 heap_t *heap_insert(heap_t **root, int value)
 {
-	heap_t *new_node, *new_node_parent;
+	heap_handle_t heap;
+	heap_t *new_node;
 
 	if (!root)
 		return (NULL);
 
-	new_node = binary_tree_node(NULL, value);
-
-	if (!*root)
-		return (*root = new_node);
-
-	if (!new_node)
-		return (NULL);
-
-	new_node_parent = get_heap_empty_slot(*root);
-
-	if (!new_node_parent->left)
-		new_node_parent->left = new_node;
-	else
-		new_node_parent->right = new_node;
-
-	new_node->parent = new_node_parent;
+	heap.root = *root;
+	heap.size = binary_tree_size(*root);
 
-	*root = maxify_up(new_node);
+	new_node = heap_handle_insert(&heap, value);
+	*root = heap.root;
 
 	return (new_node);
 }
 
 /**
- * get_heap_empty_slot - Finds an empty slot in the heap for insertion
- * @root: Pointer to the root of the heap
+ * heap_handle_insert - Inserts a value into a max heap handle
+ * @heap: Pointer to the heap handle
+ * @value: Value to insert
  *
- * Return: Pointer to the empty slot in the heap
+ * Return: Pointer to the newly inserted node, or NULL on failure
  *
- * This function traverses the binary heap to find the insertion point
- * for a new node. It starts from the root of the heap and iterates
- * down to the last level to find the appropriate empty slot. The last
- * level of the heap is filled from left to right, so the function
- * searches for the first available empty slot from left to right.
+ * The new node is attached at level-order position size + 1, whose
+ * parent is found from the bits of that position by heap_node_at.
+ * The max heap property is then restored by calling the maxify_up
+ * function on the newly inserted node, so the whole insertion
+ * costs O(log(n)).
  */
-static heap_t *get_heap_empty_slot(heap_t *root)
+heap_t *heap_handle_insert(heap_handle_t *heap, int value)
 {
-	heap_t *tree;
-	int i, tree_size, last_level_size, level_size, tree_height;
+	heap_t *new_node, *new_node_parent;
 
-	if (!root)
+	if (!heap)
+		return (NULL);
+
+	new_node = binary_tree_node(NULL, value);
+	if (!new_node)
 		return (NULL);
 
-	tree = root;
-	tree_size = binary_tree_size(tree);
+	heap->size++;
+	if (!heap->root)
+		return (heap->root = new_node);
 
-	/* Calculate the height of the tree and last level size */
-	tree_height = 0, level_size = 1;
-	for (; tree_size > level_size; level_size *= 2, tree_height++)
-		tree_size -= level_size;
+	new_node_parent = heap_node_at(heap->root, heap->size / 2);
 
-	last_level_size = tree_size;
+	if (heap->size % 2 == 0)
+		new_node_parent->left = new_node;
+	else
+		new_node_parent->right = new_node;
 
-	/* Traverse the tree to find the insertion point */
-	for (i = 0; i < tree_height; i++)
-	{
-		if (level_size == last_level_size)
-		{
-			tree = tree->left;
-			last_level_size /= 2;
-		}
-		else if (last_level_size >= (level_size / 2))
-		{
-			if (!tree->right)
-				break;
-			tree = tree->right;
-			last_level_size -= (level_size / 2);
-		}
-		else
-		{
-			if (!tree->left)
-				break;
-			tree = tree->left;
-		}
-		level_size /= 2;
-	}
-	return (tree);
-}
+	new_node->parent = new_node_parent;
 
-/**
- * binary_tree_size - Calculates the size of a binary tree
- * @tree: Pointer to the root node of the binary tree
- *
- * Return: Size of the binary tree, or 0 if @tree is NULL
- *
- * This function calculates the size of a binary tree, which is defined as the
- * total number of nodes in the tree. If the tree is empty or
- * the root node is NULL, the size is considered to be 0. Otherwise,
- * the size is calculated recursively by counting the nodes in the left
- * and right subtrees and adding 1 for the current node.
- */
-size_t binary_tree_size(const binary_tree_t *tree)
-{
-	if (!tree)
-		return (0);
+	heap->root = maxify_up(new_node);
 
-	return (1 + binary_tree_size(tree->left) + binary_tree_size(tree->right));
+	return (new_node);
 }
 
 /**
@@ -5,19 +5,25 @@
  * @array: Pointer to the array of integers
  * @size: Size of the array
  *
- * This function takes an array of integers and builds a max heap binary tree
- * from it. It iterates through the array and inserts each element into the
- * max heap binary tree using the heap_insert function.
+ * This function builds the heap bottom-up in O(n) instead of inserting
+ * the elements one by one. The values are copied into an array heap and
+ * heapified by sifting down from the last internal node, then the
+ * complete tree shape is built directly from the level-order indices.
  *
- * Return: Pointer to the root node of the max heap binary tree
+ * Return: Pointer to the root node of the max heap binary tree,
+ * or NULL on failure
  */
 heap_t *array_to_heap(int *array, size_t size)
 {
-	size_t i;
-	bst_t *root = NULL;
+	array_heap_t *array_heap;
+	heap_t *root;
 
-	for (i = 0; i < size; i++)
-		heap_insert(&root, array[i]);
+	array_heap = array_to_array_heap(array, size);
+	if (!array_heap)
+		return (NULL);
+
+	root = array_heap_to_heap(array_heap);
+	array_heap_delete(array_heap);
 
 	return (root);
 }
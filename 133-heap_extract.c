@@ -1,6 +1,5 @@
 #include "binary_trees.h"
 
-static heap_t *get_last_level_node(heap_t *root);
 static heap_t *maxify_down(heap_t *tree);
 static void swap_with_left_child(binary_tree_t *parent);
 static void swap_with_right_child(binary_tree_t *parent);
@@ -9,31 +8,59 @@ static void swap_with_right_child(binary_tree_t *parent);
  * heap_extract - Extracts the root value of a max heap binary tree
  * @root: Double pointer to the root node of the max heap binary tree
  *
- * This function extracts the root value of a max heap binary tree and
- * maintains the max heap property. It replaces the root with the last
- * node of the last level, updates the pointers accordingly, and then
- * performs the maxify_down operation to ensure the max heap property
- * is preserved.
+ * This function wraps the heap in a heap handle and extracts the root
+ * through heap_handle_extract. Callers that keep a heap_handle_t around
+ * avoid the O(n) size count done here.
  *
  * Return: The value of the root node that was extracted,
  * or 0 if the tree is empty
  */
 int heap_extract(heap_t **root)
 {
-	heap_t *new_root;
+	heap_handle_t heap;
 	int root_value;
 
 	if (!root || !*root)
 		return (0);
 
-	new_root = get_last_level_node(*root);
+	heap.root = *root;
+	heap.size = binary_tree_size(*root);
+
+	root_value = heap_handle_extract(&heap);
+	*root = heap.root;
+
+	return (root_value);
+}
+
+/**
+ * heap_handle_extract - Extracts the root value of a max heap handle
+ * @heap: Pointer to the heap handle
+ *
+ * This function extracts the root value of the heap and maintains the
+ * max heap property. It replaces the root with the last node, found
+ * from the bits of the element count by heap_node_at, updates the
+ * pointers accordingly, and then performs the maxify_down operation
+ * to ensure the max heap property is preserved, all in O(log(n)).
+ *
+ * Return: The value of the root node that was extracted,
+ * or 0 if the heap is empty
+ */
+int heap_handle_extract(heap_handle_t *heap)
+{
+	heap_t *new_root, *root;
+	int root_value;
+
+	if (!heap || !heap->root || !heap->size)
+		return (0);
+
+	root = heap->root;
+	root_value = root->n;
+	new_root = heap_node_at(root, heap->size--);
 
 	if (!new_root->parent)
 	{
-		root_value = (*root)->n;
-		free(*root);
-
-		*root = NULL;
+		binary_tree_node_free(root);
+		heap->root = NULL;
 		return (root_value);
 	}
 
@@ -43,75 +70,22 @@ int heap_extract(heap_t **root)
 		new_root->parent->right = NULL;
 
 	new_root->parent = NULL;
-	new_root->left = (*root)->left != new_root ? (*root)->left : NULL;
-	new_root->right = (*root)->right != new_root ? (*root)->right : NULL;
+	new_root->left = root->left != new_root ? root->left : NULL;
+	new_root->right = root->right != new_root ? root->right : NULL;
 
 	if (new_root->left)
 		new_root->left->parent = new_root;
 	if (new_root->right)
 		new_root->right->parent = new_root;
 
-	root_value = (*root)->n;
-	(*root)->left = (*root)->right = NULL;
+	root->left = root->right = NULL;
 
-	free(*root);
-	*root = maxify_down(new_root);
+	binary_tree_node_free(root);
+	heap->root = maxify_down(new_root);
 
 	return (root_value);
 }
 
-/**
- * get_last_level_node - Finds the last node in the last level of
- * a max heap binary tree
- * @root: Pointer to the root node of the max heap binary tree
- *
- * Return: Pointer to the last node in the last level of the
- * max heap binary tree
- */
-static heap_t *get_last_level_node(heap_t *root)
-{
-	heap_t *tree;
-	int i, tree_size, last_level_size, level_size, tree_height;
-
-	if (!root)
-		return (NULL);
-
-	tree = root;
-	tree_size = binary_tree_size(tree);
-
-	/* Calculate the height of the tree and last level size */
-	tree_height = 0, level_size = 1;
-	for (; tree_size > level_size; level_size *= 2, tree_height++)
-		tree_size -= level_size;
-
-	last_level_size = tree_size;
-
-	/* Traverse the tree to find the insertion point */
-	for (i = 0; i < tree_height; i++)
-	{
-		if (level_size == last_level_size)
-		{
-			tree = tree->right;
-			last_level_size /= 2;
-		}
-		else if (last_level_size > (level_size / 2))
-		{
-			if (!tree->right)
-				break;
-			tree = tree->right;
-			last_level_size -= (level_size / 2);
-		}
-		else
-		{
-			if (!tree->left)
-				break;
-			tree = tree->left;
-		}
-		level_size /= 2;
-	}
-	return (tree);
-}
-
 /**
  * maxify_down - Restores the max heap property in a max heap binary tree
  * @tree: Pointer to the root node of the max heap binary tree
@@ -243,23 +217,3 @@ static void swap_with_right_child(binary_tree_t *parent)
 	else
 		right_child->parent->right = right_child;
 }
-
-/**
- * binary_tree_size - Calculates the size of a binary tree
- * @tree: Pointer to the root node of the binary tree
- *
- * Return: Size of the binary tree, or 0 if @tree is NULL
- *
- * This function calculates the size of a binary tree, which is defined as the
- * total number of nodes in the tree. If the tree is empty or
- * the root node is NULL, the size is considered to be 0. Otherwise,
- * the size is calculated recursively by counting the nodes in the left
- * and right subtrees and adding 1 for the current node.
- */
-size_t binary_tree_size(const binary_tree_t *tree)
-{
-	if (!tree)
-		return (0);
-
-	return (1 + binary_tree_size(tree->left) + binary_tree_size(tree->right));
-}
@@ -5,10 +5,10 @@
  * @heap: Pointer to the root node of the max heap binary tree
  * @size: Pointer to a variable to store the size of the resulting array
  *
- * This function converts a max heap binary tree into a sorted array by
- * extracting the root value of the heap iteratively until the heap is empty.
- * It allocates memory for the resulting array, fills it with the extracted
- * values,and updates the size variable with the size of the array.
+ * This function converts a max heap binary tree into a sorted array.
+ * It allocates memory for the resulting array, then flattens and sorts
+ * the heap with heap_to_sorted_buffer, freeing every node of the heap
+ * on the way, and updates the size variable with the size of the array.
  *
  * Return: Pointer to the sorted array, or NULL if @heap
  * is NULL or @size is NULL,
@@ -16,7 +16,7 @@
  */
 int *heap_to_sorted_array(heap_t *heap, size_t *size)
 {
-	int i, *array = NULL;
+	int *array = NULL;
 
 	if (!heap || !size)
 		return (NULL);
@@ -27,8 +27,58 @@ int *heap_to_sorted_array(heap_t *heap, size_t *size)
 	if (!array)
 		return (NULL);
 
-	for (i = 0; heap; i++)
-		array[i] = heap_extract(&heap);
+	return (heap_to_sorted_buffer(heap, array, *size, size, true));
+}
+
+/**
+ * heap_to_sorted_buffer - Sorts the values of a max heap into a buffer
+ * @heap: Pointer to the root node of the max heap binary tree
+ * @buffer: Caller-supplied array receiving the values
+ * @capacity: Number of values @buffer can hold
+ * @size: Pointer to a variable to store the number of values
+ * @destroy: true to free the nodes of the heap during the same sweep
+ *
+ * The heap is flattened once into @buffer in level order, which is a
+ * valid array heap, then sorted in place by array_heap_sort. The whole
+ * conversion runs in O(n log(n)) without extra allocation.
+ *
+ * Return: @buffer sorted in descending order, or NULL if an argument is
+ * NULL or @buffer is too small (then @size holds the required capacity
+ * and the heap is left untouched)
+ */
+int *heap_to_sorted_buffer(heap_t *heap, int *buffer, size_t capacity,
+			   size_t *size, bool destroy)
+{
+	if (!heap || !buffer || !size)
+		return (NULL);
+
+	*size = binary_tree_size(heap);
+	if (*size > capacity)
+		return (NULL);
+
+	heap_flatten(heap, buffer, 0, destroy);
+	array_heap_sort(buffer, *size);
+
+	return (buffer);
+}
+
+/**
+ * heap_flatten - Writes a complete binary tree into an array in level order
+ * @tree: Pointer to the current node
+ * @array: Destination array
+ * @index: Level-order index of @tree
+ * @destroy: true to free each node once its subtree is written, false to
+ * leave the tree untouched
+ */
+void heap_flatten(heap_t *tree, int *array, size_t index, bool destroy)
+{
+	if (!tree)
+		return;
+
+	array[index] = tree->n;
+	heap_flatten(tree->left, array, 2 * index + 1, destroy);
+	heap_flatten(tree->right, array, 2 * index + 2, destroy);
 
-	return (array);
+	if (destroy)
+		binary_tree_node_free(tree);
 }
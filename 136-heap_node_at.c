@@ -0,0 +1,28 @@
+#include "binary_trees.h"
+
+/**
+ * heap_node_at - Finds a heap node from its level-order position
+ * @root: Pointer to the root node of the heap
+ * @index: 1-based level-order position of the node (the root is 1)
+ *
+ * In a complete binary tree, the bits of @index below its most
+ * significant bit spell the path from the root to the node, a 0 meaning
+ * left and a 1 meaning right. Following them costs O(log(n)).
+ *
+ * Return: Pointer to the node at @index, or NULL if there is none
+ */
+heap_t *heap_node_at(const heap_t *root, size_t index)
+{
+	size_t bit = 1;
+
+	if (!root || !index)
+		return (NULL);
+
+	while (bit <= index / 2)
+		bit <<= 1;
+
+	for (bit >>= 1; bit && root; bit >>= 1)
+		root = (index & bit) ? root->right : root->left;
+
+	return ((heap_t *)root);
+}
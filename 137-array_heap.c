@@ -0,0 +1,116 @@
+#include "binary_trees.h"
+
+/**
+ * array_heap_create - Creates an empty array-backed max heap
+ * @capacity: Number of values to reserve room for (at least 1 is reserved)
+ *
+ * Return: Pointer to the new heap, or NULL on failure
+ */
+array_heap_t *array_heap_create(size_t capacity)
+{
+	array_heap_t *heap = malloc(sizeof(array_heap_t));
+
+	if (!heap)
+		return (NULL);
+
+	heap->capacity = capacity ? capacity : 1;
+	heap->size = 0;
+	heap->data = malloc(sizeof(int) * heap->capacity);
+	if (!heap->data)
+	{
+		free(heap);
+		return (NULL);
+	}
+
+	return (heap);
+}
+
+/**
+ * array_heap_delete - Frees an array-backed max heap
+ * @heap: Pointer to the heap to free
+ */
+void array_heap_delete(array_heap_t *heap)
+{
+	if (!heap)
+		return;
+
+	free(heap->data);
+	free(heap);
+}
+
+/**
+ * array_heap_insert - Inserts a value into an array-backed max heap
+ * @heap: Pointer to the heap
+ * @value: Value to insert
+ *
+ * The array doubles when full, then the value is sifted up from the
+ * first free slot by moving smaller parents down into the hole.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int array_heap_insert(array_heap_t *heap, int value)
+{
+	size_t i, parent, capacity;
+	int *data;
+
+	if (!heap)
+		return (0);
+
+	if (heap->size == heap->capacity)
+	{
+		capacity = heap->capacity ? heap->capacity * 2 : 1;
+		data = realloc(heap->data, sizeof(int) * capacity);
+		if (!data)
+			return (0);
+		heap->data = data;
+		heap->capacity = capacity;
+	}
+
+	for (i = heap->size++; i > 0; i = parent)
+	{
+		parent = (i - 1) / 2;
+		if (heap->data[parent] >= value)
+			break;
+		heap->data[i] = heap->data[parent];
+	}
+	heap->data[i] = value;
+
+	return (1);
+}
+
+/**
+ * array_heap_extract - Extracts the root value of an array-backed max heap
+ * @heap: Pointer to the heap
+ *
+ * The last value replaces the root and is sifted down.
+ *
+ * Return: The value of the root that was extracted,
+ * or 0 if the heap is empty
+ */
+int array_heap_extract(array_heap_t *heap)
+{
+	int root_value;
+
+	if (!heap || !heap->size)
+		return (0);
+
+	root_value = heap->data[0];
+	heap->data[0] = heap->data[--heap->size];
+	array_heap_sift_down(heap->data, heap->size, 0);
+
+	return (root_value);
+}
+
+/**
+ * array_heap_peek - Reads the root value of an array-backed max heap
+ * @heap: Pointer to the heap
+ *
+ * Return: The largest value in the heap, or 0 if the heap is empty
+ */
+int array_heap_peek(const array_heap_t *heap)
+{
+	if (!heap || !heap->size)
+		return (0);
+
+	return (heap->data[0]);
+}
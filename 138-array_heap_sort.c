@@ -0,0 +1,134 @@
+#include "binary_trees.h"
+
+/**
+ * array_heap_sift_down - Moves a value down an array max heap
+ * @array: Array holding the heap
+ * @size: Number of values in the heap
+ * @index: Index of the value to sift down
+ *
+ * Larger children are moved up into the hole until the value fits.
+ */
+void array_heap_sift_down(int *array, size_t size, size_t index)
+{
+	size_t child;
+	int value;
+
+	if (!array || index >= size)
+		return;
+
+	value = array[index];
+	for (child = 2 * index + 1; child < size; child = 2 * index + 1)
+	{
+		if (child + 1 < size && array[child + 1] > array[child])
+			child++;
+		if (array[child] <= value)
+			break;
+		array[index] = array[child];
+		index = child;
+	}
+	array[index] = value;
+}
+
+/**
+ * array_heapify - Turns an array into a max heap in place
+ * @array: Array of integers
+ * @size: Number of elements in the array
+ *
+ * Sifts down every internal node, starting from the last one,
+ * which builds the heap in O(n).
+ */
+void array_heapify(int *array, size_t size)
+{
+	size_t i;
+
+	if (!array || size < 2)
+		return;
+
+	for (i = size / 2; i > 0; i--)
+		array_heap_sift_down(array, size, i - 1);
+}
+
+/**
+ * array_to_array_heap - Builds an array-backed max heap from an array
+ * @array: Pointer to the array of integers
+ * @size: Size of the array
+ *
+ * Return: Pointer to the new heap, or NULL on failure
+ */
+array_heap_t *array_to_array_heap(int *array, size_t size)
+{
+	array_heap_t *heap;
+
+	if (!array)
+		return (NULL);
+
+	heap = array_heap_create(size);
+	if (!heap)
+		return (NULL);
+
+	memcpy(heap->data, array, sizeof(int) * size);
+	heap->size = size;
+	array_heapify(heap->data, size);
+
+	return (heap);
+}
+
+/**
+ * array_heap_sort - Sorts an array max heap in place in descending order
+ * @array: Array holding a max heap
+ * @size: Number of values in the heap
+ *
+ * Heapsort leaves the values in ascending order, which is then reversed,
+ * so the sort runs in O(n log(n)) without any extra memory.
+ */
+void array_heap_sort(int *array, size_t size)
+{
+	size_t i, end;
+	int tmp;
+
+	if (!array || size < 2)
+		return;
+
+	for (end = size - 1; end > 0; end--)
+	{
+		tmp = array[0];
+		array[0] = array[end];
+		array[end] = tmp;
+		array_heap_sift_down(array, end, 0);
+	}
+
+	for (i = 0; i < size / 2; i++)
+	{
+		tmp = array[i];
+		array[i] = array[size - 1 - i];
+		array[size - 1 - i] = tmp;
+	}
+}
+
+/**
+ * array_heap_to_sorted_array - Sorts the values of an array-backed max heap
+ * @heap: Pointer to the heap, left empty on success
+ * @size: Pointer to a variable to store the size of the resulting array
+ *
+ * The heap is sorted in place by array_heap_sort, then its buffer is
+ * handed over to the caller.
+ *
+ * Return: Pointer to the array sorted in descending order, or NULL if
+ * @heap is NULL, empty or @size is NULL
+ */
+int *array_heap_to_sorted_array(array_heap_t *heap, size_t *size)
+{
+	int *array;
+
+	if (!heap || !heap->size || !size)
+		return (NULL);
+
+	array = heap->data;
+	array_heap_sort(array, heap->size);
+
+	*size = heap->size;
+	heap->data = NULL;
+	heap->size = heap->capacity = 0;
+
+	return (array);
+}
@@ -0,0 +1,80 @@
+#include "binary_trees.h"
+
+static heap_t *build(const int *array, size_t size, size_t index,
+		     heap_t *parent);
+
+/**
+ * heap_to_array_heap - Copies a max heap binary tree into an array heap
+ * @heap: Pointer to the root node of the max heap binary tree
+ *
+ * Each node is stored at its level-order index, so the array is a valid
+ * heap as soon as it is filled. The conversion runs in O(n).
+ *
+ * Return: Pointer to the new array heap, or NULL on failure
+ */
+array_heap_t *heap_to_array_heap(const heap_t *heap)
+{
+	array_heap_t *array_heap;
+	size_t size = binary_tree_size(heap);
+
+	array_heap = array_heap_create(size);
+	if (!array_heap)
+		return (NULL);
+
+	heap_flatten((heap_t *)heap, array_heap->data, 0, false);
+	array_heap->size = size;
+
+	return (array_heap);
+}
+
+/**
+ * array_heap_to_heap - Copies an array heap into a max heap binary tree
+ * @heap: Pointer to the array heap
+ *
+ * The complete tree shape is built directly from the level-order indices,
+ * so no sifting is needed and the conversion runs in O(n).
+ *
+ * Return: Pointer to the root node of the new heap, or NULL on failure
+ * (any partially built tree is freed)
+ */
+heap_t *array_heap_to_heap(const array_heap_t *heap)
+{
+	if (!heap || !heap->size)
+		return (NULL);
+
+	return (build(heap->data, heap->size, 0, NULL));
+}
+
+/**
+ * build - Builds the complete binary tree of an array in level order
+ * @array: Source array
+ * @size: Number of values in @array
+ * @index: Level-order index of the node to build
+ * @parent: Parent of the node to build
+ *
+ * Return: Pointer to the root of the built subtree, or NULL on failure
+ */
+static heap_t *build(const int *array, size_t size, size_t index,
+		     heap_t *parent)
+{
+	heap_t *node;
+
+	if (index >= size)
+		return (NULL);
+
+	node = binary_tree_node(parent, array[index]);
+	if (!node)
+		return (NULL);
+
+	node->left = build(array, size, 2 * index + 1, node);
+	node->right = build(array, size, 2 * index + 2, node);
+
+	if ((2 * index + 1 < size && !node->left) ||
+	    (2 * index + 2 < size && !node->right))
+	{
+		binary_tree_delete(node);
+		return (NULL);
+	}
+
+	return (node);
+}
@@ -0,0 +1,55 @@
+#include "binary_trees.h"
+
+/**
+ * rb_insert - Inserts a value into a red-black tree.
+ * @tree: Pointer to the root pointer of the red-black tree.
+ * @value: Value to insert into the red-black tree.
+ *
+ * The value is inserted as a red leaf by bst_insert. While its parent is
+ * also red, a red uncle is recolored and the check moves two levels up;
+ * a black uncle is fixed by at most two rotations, after which the tree
+ * is valid. Recoloring is O(log(n)) and rotations are O(1) per insertion.
+ *
+ * Return: Pointer to the newly inserted node, or NULL if the value is
+ * already present or on failure.
+ */
+rb_t *rb_insert(rb_t **tree, int value)
+{
+	rb_t *new_node, *node, *parent, *grand, *uncle;
+	int dir;
+
+	new_node = bst_insert(tree, value);
+	if (!new_node)
+		return (NULL);
+
+	node = new_node;
+	while (node->parent && node->parent->color == RB_RED)
+	{
+		parent = node->parent;
+		grand = parent->parent;
+		dir = parent == grand->right;
+		uncle = rb_child(grand, !dir);
+
+		if (uncle && uncle->color == RB_RED)
+		{
+			parent->color = uncle->color = RB_BLACK;
+			grand->color = RB_RED;
+			node = grand;
+			continue;
+		}
+
+		if (node == rb_child(parent, !dir))
+		{
+			rb_rotate(tree, parent, dir);
+			parent = node;
+		}
+		parent->color = RB_BLACK;
+		grand->color = RB_RED;
+		rb_rotate(tree, grand, !dir);
+		break;
+	}
+
+	(*tree)->color = RB_BLACK;
+
+	return (new_node);
+}
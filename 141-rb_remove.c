@@ -0,0 +1,118 @@
+#include "binary_trees.h"
+
+static rb_t *remove_fixup(rb_t *root, rb_t *node, rb_t *parent);
+static bool is_black(const rb_t *node);
+
+/**
+ * rb_remove - Removes a node with a specific value from a red-black tree.
+ * @root: Pointer to the root of the red-black tree.
+ * @value: Value of the node to be removed.
+ *
+ * A node with two children takes the value of its in-order successor,
+ * which is unlinked instead, and the cached sizes of its ancestors are
+ * decremented. Unlinking a black node leaves its side one black short;
+ * remove_fixup repairs it with at most three rotations.
+ *
+ * Return: Pointer to the root of the red-black tree after removal.
+ */
+rb_t *rb_remove(rb_t *root, int value)
+{
+	rb_t *node, *next, *parent, *ancestor;
+
+	node = rb_search(root, value);
+	if (!node)
+		return (root);
+
+	if (node->left && node->right)
+	{
+		for (next = node->right; next->left; next = next->left)
+			;
+		node->n = next->n;
+		node = next;
+	}
+
+	next = node->left ? node->left : node->right;
+	parent = node->parent;
+
+	if (next)
+		next->parent = parent;
+	if (!parent)
+		root = next;
+	else if (parent->left == node)
+		parent->left = next;
+	else
+		parent->right = next;
+	for (ancestor = parent; ancestor; ancestor = ancestor->parent)
+		ancestor->size--;
+
+	if (node->color == RB_BLACK)
+		root = remove_fixup(root, next, parent);
+
+	node->left = node->right = node->parent = NULL;
+	binary_tree_node_free(node);
+
+	return (root);
+}
+
+/**
+ * remove_fixup - Restores the black height after a black node is unlinked.
+ * @root: Pointer to the root of the red-black tree.
+ * @node: Pointer to the node that took the unlinked node's place (may be
+ * NULL), whose side is one black short.
+ * @parent: Pointer to the parent of @node.
+ *
+ * Return: Pointer to the root of the red-black tree after the repair.
+ */
+static rb_t *remove_fixup(rb_t *root, rb_t *node, rb_t *parent)
+{
+	rb_t *sibling;
+	int dir;
+
+	while (node != root && is_black(node))
+	{
+		dir = node != parent->left;
+		sibling = rb_child(parent, !dir);
+		if (sibling->color == RB_RED)
+		{
+			sibling->color = RB_BLACK;
+			parent->color = RB_RED;
+			rb_rotate(&root, parent, dir);
+			sibling = rb_child(parent, !dir);
+		}
+		if (is_black(sibling->left) && is_black(sibling->right))
+		{
+			sibling->color = RB_RED;
+			node = parent;
+			parent = node->parent;
+			continue;
+		}
+		if (is_black(rb_child(sibling, !dir)))
+		{
+			rb_child(sibling, dir)->color = RB_BLACK;
+			sibling->color = RB_RED;
+			rb_rotate(&root, sibling, !dir);
+			sibling = rb_child(parent, !dir);
+		}
+		sibling->color = parent->color;
+		parent->color = RB_BLACK;
+		rb_child(sibling, !dir)->color = RB_BLACK;
+		rb_rotate(&root, parent, dir);
+		node = root;
+	}
+
+	if (node)
+		node->color = RB_BLACK;
+
+	return (root);
+}
+
+/**
+ * is_black - Checks if a node is black, empty children being black.
+ * @node: Pointer to the node, may be NULL.
+ *
+ * Return: true if @node is NULL or black, false otherwise.
+ */
+static bool is_black(const rb_t *node)
+{
+	return (!node || node->color == RB_BLACK);
+}
@@ -0,0 +1,20 @@
+#include "binary_trees.h"
+
+/**
+ * rb_search - Searches for a value in a red-black tree.
+ *
+ * Walks down iteratively; the red-black height bound keeps the walk
+ * to at most 2 * log2(n + 1) levels.
+ *
+ * @tree: A pointer to the root node of the red-black tree.
+ * @value: The value to search for.
+ * Return: A pointer to the node containing the value if found,
+ * NULL otherwise.
+ */
+rb_t *rb_search(const rb_t *tree, int value)
+{
+	while (tree && tree->n != value)
+		tree = value < tree->n ? tree->left : tree->right;
+
+	return ((rb_t *)tree);
+}
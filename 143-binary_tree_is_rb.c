@@ -0,0 +1,49 @@
+#include "binary_trees.h"
+
+static int black_height(const binary_tree_t *tree);
+
+/**
+ * binary_tree_is_rb - Checks if a binary tree is a valid red-black tree.
+ *
+ * The tree must be a BST with a black root, no red node may have a red
+ * child, and every path from a node down to an empty child must cross
+ * the same number of black nodes.
+ *
+ * @tree: A pointer to the root node of the binary tree to be checked.
+ * Return: 1 if the binary tree is a red-black tree, 0 otherwise.
+ */
+int binary_tree_is_rb(const binary_tree_t *tree)
+{
+	if (!tree || tree->color != RB_BLACK)
+		return (0);
+
+	return (binary_tree_is_bst(tree) && black_height(tree) != -1);
+}
+
+/**
+ * black_height - Helper function to compute the black height of a tree
+ * while checking the red-black coloring rules.
+ *
+ * @tree: A pointer to the root node of the subtree.
+ * Return: The number of black nodes on any path down to an empty child,
+ * or -1 if a coloring rule is broken in the subtree.
+ */
+static int black_height(const binary_tree_t *tree)
+{
+	int left, right;
+
+	if (!tree)
+		return (0);
+
+	if (tree->color == RB_RED &&
+	    ((tree->left && tree->left->color == RB_RED) ||
+	     (tree->right && tree->right->color == RB_RED)))
+		return (-1);
+
+	left = black_height(tree->left);
+	right = black_height(tree->right);
+	if (left == -1 || right == -1 || left != right)
+		return (-1);
+
+	return (left + (tree->color == RB_BLACK));
+}
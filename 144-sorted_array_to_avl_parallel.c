@@ -0,0 +1,147 @@
+#include <pthread.h>
+#include "binary_trees.h"
+
+/* Ranges smaller than this are not worth a thread */
+#define PARALLEL_CUTOFF 65536
+
+/**
+ * struct build_task_s - Subtree handed to another thread
+ *
+ * @array: Pointer to the sorted array of integers
+ * @lo: Index of the first element of the subarray
+ * @hi: Index past the last element of the subarray
+ * @threads: Number of threads the subtree may use
+ * @tree: Pointer to the root of the built subtree
+ */
+typedef struct build_task_s
+{
+	int *array;
+	size_t lo;
+	size_t hi;
+	size_t threads;
+	avl_t *tree;
+} build_task_t;
+
+static avl_t *build(int *array, size_t lo, size_t hi, size_t threads);
+static avl_t *attach(avl_t *tree, avl_t *left, avl_t *right, bool complete);
+static void *build_task(void *arg);
+
+/**
+ * sorted_array_to_avl_parallel - Constructs an AVL tree from a
+ * sorted array of integers using several threads.
+ * @array: Pointer to the sorted array of integers.
+ * @size: Size of the array.
+ * @threads: Number of threads to use, 0 for one per online processor.
+ *
+ * The left and right halves of a sorted array are independent, so the
+ * left half is built on a new thread while the current one builds the
+ * right half, splitting the thread budget between them until it runs out
+ * or the subarray falls under PARALLEL_CUTOFF. Each thread allocates its
+ * nodes from its own malloc arena. Small inputs, a single thread or an
+ * active node pool, which worker threads would not allocate from, fall
+ * back to a sequential build. The tree is the same as the one built by sorted_array_to_avl.
+ *
+ * Return: Pointer to the root of the constructed AVL tree,
+ * or NULL on failure.
+ */
+avl_t *sorted_array_to_avl_parallel(int *array, size_t size, size_t threads)
+{
+	if (!array || !size)
+		return (NULL);
+
+	threads = thread_count(threads);
+	if (node_pool_active())
+		threads = 1;
+
+	return (build(array, 0, size, threads));
+}
+
+/**
+ * build - Builds the AVL subtree of a sorted subarray.
+ * @array: Pointer to the sorted array of integers.
+ * @lo: Index of the first element of the subarray.
+ * @hi: Index past the last element of the subarray.
+ * @threads: Number of threads the subtree may use.
+ *
+ * Return: Pointer to the root of the subtree, or NULL if the subarray is
+ * empty or on failure, in which case every node built so far is freed.
+ */
+static avl_t *build(int *array, size_t lo, size_t hi, size_t threads)
+{
+	build_task_t task;
+	pthread_t thread;
+	avl_t *tree, *right;
+	size_t mid;
+	bool spawned = false;
+
+	if (lo >= hi)
+		return (NULL);
+
+	mid = (hi - lo - 1) / 2 + lo;
+	tree = binary_tree_node(NULL, array[mid]);
+	if (!tree)
+		return (NULL);
+
+	task.array = array;
+	task.lo = lo;
+	task.hi = mid;
+	task.threads = threads / 2;
+	task.tree = NULL;
+	if (threads > 1 && hi - lo >= PARALLEL_CUTOFF)
+		spawned = !pthread_create(&thread, NULL, build_task, &task);
+
+	right = build(array, mid + 1, hi, threads - threads / 2);
+	if (spawned)
+		pthread_join(thread, NULL);
+	else
+		build_task(&task);
+
+	return (attach(tree, task.tree, right,
+		       (task.tree || lo == mid) && (right || mid + 1 == hi)));
+}
+
+/**
+ * attach - Links a node to its two built subtrees.
+ * @tree: Pointer to the node.
+ * @left: Pointer to the root of the left subtree, or NULL.
+ * @right: Pointer to the root of the right subtree, or NULL.
+ * @complete: false if a non-empty subtree failed to build.
+ *
+ * Return: Pointer to @tree with its cached height and size set, or NULL
+ * if @complete is false, in which case @tree and both subtrees are freed.
+ */
+static avl_t *attach(avl_t *tree, avl_t *left, avl_t *right, bool complete)
+{
+	tree->left = left;
+	tree->right = right;
+	if (left)
+		left->parent = tree;
+	if (right)
+		right->parent = tree;
+
+	if (!complete)
+	{
+		binary_tree_delete(tree);
+		return (NULL);
+	}
+
+	avl_update_height(tree);
+	bst_update_size(tree);
+
+	return (tree);
+}
+
+/**
+ * build_task - Thread entry point building the subtree of a task.
+ * @arg: Pointer to the build_task_t to fill.
+ *
+ * Return: Always NULL, the subtree is stored in the task.
+ */
+static void *build_task(void *arg)
+{
+	build_task_t *task = arg;
+
+	task->tree = build(task->array, task->lo, task->hi, task->threads);
+
+	return (NULL);
+}
@@ -0,0 +1,78 @@
+#include "binary_trees.h"
+
+/* Cache line size the keys are aligned on */
+#define FROZEN_ALIGN 64
+
+/**
+ * bst_freeze - Copies a BST into a read-only array in Eytzinger order
+ * @tree: Pointer to the root node of the BST
+ *
+ * The keys are laid out like an array-backed complete binary tree: the
+ * children of the key at index i are at 2i and 2i + 1, starting from 1.
+ * The top levels of every search therefore share the first cache lines,
+ * and the 16 grandchildren four levels below a key sit in a single cache
+ * line that can be prefetched ahead of time. The BST is walked in order
+ * through its parent pointers while the matching slot of the implicit
+ * tree is walked in order as well, so the keys land directly in place
+ * without recursion or intermediate sorted copy. The walk stops after the
+ * last node of @tree, which may be a subtree of a larger BST, instead of
+ * climbing into its ancestors. The BST is left intact.
+ *
+ * Return: Pointer to the frozen tree, or NULL if @tree is NULL or on failure
+ */
+frozen_tree_t *bst_freeze(const bst_t *tree)
+{
+	frozen_tree_t *frozen;
+	const bst_t *node;
+	void *keys;
+	size_t size, i, count;
+
+	if (!tree)
+		return (NULL);
+
+	size = binary_tree_size(tree);
+	frozen = malloc(sizeof(*frozen));
+	if (!frozen)
+		return (NULL);
+	if (posix_memalign(&keys, FROZEN_ALIGN, sizeof(int) * (size + 1)))
+	{
+		free(frozen);
+		return (NULL);
+	}
+	frozen->keys = keys;
+	frozen->keys[0] = 0;
+	frozen->size = size;
+
+	for (node = tree; node->left; node = node->left)
+		;
+	for (i = 1; 2 * i <= size; i *= 2)
+		;
+	for (count = 0; count < size; count++, node = bst_successor(node))
+	{
+		frozen->keys[i] = node->n;
+		if (2 * i + 1 <= size)
+			for (i = 2 * i + 1; 2 * i <= size; i *= 2)
+				;
+		else
+		{
+			while (i & 1)
+				i >>= 1;
+			i >>= 1;
+		}
+	}
+
+	return (frozen);
+}
+
+/**
+ * frozen_tree_delete - Frees a frozen tree
+ * @frozen: Pointer to the frozen tree, may be NULL
+ */
+void frozen_tree_delete(frozen_tree_t *frozen)
+{
+	if (!frozen)
+		return;
+
+	free(frozen->keys);
+	free(frozen);
+}
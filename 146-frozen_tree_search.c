@@ -0,0 +1,50 @@
+#include "binary_trees.h"
+
+/**
+ * frozen_tree_lower_bound - Finds the smallest key not less than a value
+ * @frozen: Pointer to the frozen tree
+ * @value: Value to look for
+ *
+ * The descent has no data-dependent branch: each step moves to the child
+ * 2i or 2i + 1 depending on the comparison, and the cache line holding the
+ * 16 descendants four levels down is prefetched meanwhile, so up to four
+ * memory accesses are in flight instead of one miss per level. Once the
+ * descent falls off the tree, the last left turn is recovered by
+ * dropping the trailing right turns (the trailing 1 bits) and one more.
+ *
+ * Return: Pointer to the key, or NULL if every key is less than @value
+ */
+const int *frozen_tree_lower_bound(const frozen_tree_t *frozen, int value)
+{
+	const int *keys;
+	size_t i, size;
+
+	if (!frozen)
+		return (NULL);
+
+	keys = frozen->keys;
+	size = frozen->size;
+	for (i = 1; i <= size; i = 2 * i + (keys[i] < value))
+		__builtin_prefetch(keys + 16 * i);
+
+	i >>= __builtin_ffsl((long)~i);
+
+	return (i ? keys + i : NULL);
+}
+
+/**
+ * frozen_tree_search - Searches for a value in a frozen tree
+ * @frozen: Pointer to the frozen tree
+ * @value: Value to look for
+ *
+ * Return: Pointer to the key equal to @value, or NULL if there is none
+ */
+const int *frozen_tree_search(const frozen_tree_t *frozen, int value)
+{
+	const int *key = frozen_tree_lower_bound(frozen, value);
+
+	if (!key || *key != value)
+		return (NULL);
+
+	return (key);
+}
@@ -0,0 +1,109 @@
+#include "binary_trees.h"
+
+/* Number of searches advanced together, enough to cover memory latency */
+#define BATCH_WIDTH 32
+
+/**
+ * struct batch_s - Group of searches advanced together
+ *
+ * @cursor: Node each search has reached
+ * @lane: Index of the value of each search in the keys
+ * @active: Number of unfinished searches, at the front of @cursor
+ * @found: Number of values found so far
+ */
+typedef struct batch_s
+{
+	const bst_t *cursor[BATCH_WIDTH];
+	size_t lane[BATCH_WIDTH];
+	size_t active;
+	size_t found;
+} batch_t;
+
+static bool advance(batch_t *batch, size_t i, const int *keys, bst_t **out);
+
+/**
+ * bst_search_batch - Searches for many values in a BST at once
+ * @tree: Pointer to the root node of the BST
+ * @keys: Values to search for
+ * @count: Number of values
+ * @out: Buffer of @count pointers receiving, for each value, the node
+ * holding it or NULL if it is absent
+ *
+ * A single search is a chain of dependent loads, one cache miss per level
+ * on large trees. The values are instead searched BATCH_WIDTH at a time,
+ * advancing every unfinished search by one level per round: the next node
+ * of each search is prefetched when it is chosen and only read in the next
+ * round, after the other searches had their turn, so the misses of the
+ * whole group overlap. Finished searches are swapped out of the group.
+ *
+ * Return: Number of values found
+ */
+size_t bst_search_batch(const bst_t *tree, const int *keys, size_t count,
+			bst_t **out)
+{
+	batch_t batch;
+	size_t base, width, i;
+
+	if (!keys || !out)
+		return (0);
+
+	batch.found = 0;
+	for (base = 0; base < count; base += width)
+	{
+		width = count - base < BATCH_WIDTH ? count - base : BATCH_WIDTH;
+		for (i = 0; i < width; i++)
+		{
+			batch.cursor[i] = tree;
+			batch.lane[i] = base + i;
+		}
+
+		for (batch.active = tree ? width : 0; batch.active;)
+			for (i = 0; i < batch.active;)
+				if (advance(&batch, i, keys, out))
+					i++;
+
+		if (!tree)
+			for (i = 0; i < width; i++)
+				out[base + i] = NULL;
+	}
+
+	return (batch.found);
+}
+
+/**
+ * advance - Moves one search of a group down by one level
+ * @batch: Pointer to the group
+ * @i: Index of the search in the group
+ * @keys: Values to search for
+ * @out: Buffer receiving the result of each finished search
+ *
+ * The next node is prefetched so that it is in cache by the time the
+ * search gets its next turn. A search that finds its value or falls off
+ * the tree is retired, and the last active search takes its place.
+ *
+ * Return: true if the search is still active at index @i, false if it was
+ * retired and index @i now holds another search
+ */
+static bool advance(batch_t *batch, size_t i, const int *keys, bst_t **out)
+{
+	const bst_t *node = batch->cursor[i];
+	int value = keys[batch->lane[i]];
+
+	if (node->n != value)
+		node = node->n > value ? node->left : node->right;
+	else
+		batch->found++;
+	if (node && node != batch->cursor[i])
+	{
+		__builtin_prefetch(node);
+		batch->cursor[i] = node;
+		return (true);
+	}
+
+	out[batch->lane[i]] = (bst_t *)node;
+	batch->active--;
+	batch->cursor[i] = batch->cursor[batch->active];
+	batch->lane[i] = batch->lane[batch->active];
+
+	return (false);
+}
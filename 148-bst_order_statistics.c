@@ -0,0 +1,95 @@
+#include "binary_trees.h"
+
+static size_t count_below(const bst_t *tree, int value, bool inclusive);
+
+/**
+ * bst_select - Finds the k-th smallest value of a BST
+ * @tree: Pointer to the root node of the BST
+ * @k: Rank of the value to find, 0 being the smallest
+ *
+ * Each step compares @k with the size of the left subtree to decide
+ * whether the value is on the left, at the node or on the right,
+ * so the search costs O(h).
+ *
+ * Return: Pointer to the node holding the value, or NULL if @k is not
+ * less than the size of @tree
+ */
+bst_t *bst_select(const bst_t *tree, size_t k)
+{
+	size_t left;
+
+	while (tree)
+	{
+		left = bst_size(tree->left);
+		if (k == left)
+			return ((bst_t *)tree);
+		if (k < left)
+			tree = tree->left;
+		else
+		{
+			k -= left + 1;
+			tree = tree->right;
+		}
+	}
+
+	return (NULL);
+}
+
+/**
+ * bst_rank - Counts the values of a BST less than a given value
+ * @tree: Pointer to the root node of the BST
+ * @value: Value to compare with
+ *
+ * When @value is in the tree, this is also its rank for bst_select.
+ *
+ * Return: Number of values less than @value
+ */
+size_t bst_rank(const bst_t *tree, int value)
+{
+	return (count_below(tree, value, false));
+}
+
+/**
+ * bst_count_range - Counts the values of a BST within a closed range
+ * @tree: Pointer to the root node of the BST
+ * @lo: Lower bound of the range, included
+ * @hi: Upper bound of the range, included
+ *
+ * Return: Number of values v such that @lo <= v <= @hi
+ */
+size_t bst_count_range(const bst_t *tree, int lo, int hi)
+{
+	if (lo > hi)
+		return (0);
+
+	return (count_below(tree, hi, true) - count_below(tree, lo, false));
+}
+
+/**
+ * count_below - Counts the values of a BST below a given value
+ * @tree: Pointer to the root node of the BST
+ * @value: Value to compare with
+ * @inclusive: true to also count the value itself
+ *
+ * Every time the descent goes right, the node and its whole left
+ * subtree are below @value and are counted at once from the cached size.
+ *
+ * Return: Number of values less than, or not greater than, @value
+ */
+static size_t count_below(const bst_t *tree, int value, bool inclusive)
+{
+	size_t count = 0;
+
+	while (tree)
+	{
+		if (tree->n < value || (inclusive && tree->n == value))
+		{
+			count += bst_size(tree->left) + 1;
+			tree = tree->right;
+		}
+		else
+			tree = tree->left;
+	}
+
+	return (count);
+}
@@ -0,0 +1,84 @@
+#include "binary_trees.h"
+
+/**
+ * bst_lower_bound - Finds the node holding the smallest value of a BST
+ * that is not less than a given value
+ * @tree: Pointer to the root node of the BST
+ * @value: Value to compare with
+ *
+ * Return: Pointer to the node, or NULL if every value is less than @value
+ */
+bst_t *bst_lower_bound(const bst_t *tree, int value)
+{
+	const bst_t *bound = NULL;
+
+	while (tree)
+	{
+		if (tree->n < value)
+			tree = tree->right;
+		else
+		{
+			bound = tree;
+			tree = tree->left;
+		}
+	}
+
+	return ((bst_t *)bound);
+}
+
+/**
+ * bst_successor - Finds the in-order successor of a node in a BST
+ * @node: Pointer to the node
+ *
+ * The successor is the leftmost node of the right subtree if there is
+ * one, and the first ancestor reached from its left side otherwise.
+ * Walking a whole tree this way touches every edge twice, so it costs
+ * O(1) amortized per node and needs neither recursion nor a stack.
+ *
+ * Return: Pointer to the successor, or NULL if @node is NULL or holds
+ * the largest value
+ */
+bst_t *bst_successor(const bst_t *node)
+{
+	if (!node)
+		return (NULL);
+
+	if (node->right)
+	{
+		for (node = node->right; node->left; node = node->left)
+			;
+		return ((bst_t *)node);
+	}
+
+	while (node->parent && node->parent->right == node)
+		node = node->parent;
+
+	return (node->parent);
+}
+
+/**
+ * bst_predecessor - Finds the in-order predecessor of a node in a BST
+ * @node: Pointer to the node
+ *
+ * This is the mirror image of bst_successor.
+ *
+ * Return: Pointer to the predecessor, or NULL if @node is NULL or holds
+ * the smallest value
+ */
+bst_t *bst_predecessor(const bst_t *node)
+{
+	if (!node)
+		return (NULL);
+
+	if (node->left)
+	{
+		for (node = node->left; node->right; node = node->right)
+			;
+		return ((bst_t *)node);
+	}
+
+	while (node->parent && node->parent->left == node)
+		node = node->parent;
+
+	return (node->parent);
+}
@@ -0,0 +1,93 @@
+#include "binary_trees.h"
+
+static bool clamp_high(const bst_t *tree, int *hi);
+
+/**
+ * bst_range - Visits in order the nodes of a BST within a closed range
+ * @tree: Pointer to the root node of the BST
+ * @lo: Lower bound of the range, included
+ * @hi: Upper bound of the range, included
+ * @func: Pointer to the function to call for each node, returning
+ * nonzero to stop the walk
+ * @ctx: Pointer passed to @func as is
+ *
+ * The first node of the range is found with one descent and the others
+ * are reached through bst_successor, so subtrees outside the range are
+ * never entered and a range of k values costs O(h + k). The upper bound is
+ * clamped to the greatest value of @tree, so a walk over a subtree of a
+ * larger BST never climbs into its ancestors.
+ *
+ * Return: Number of nodes passed to @func
+ */
+size_t bst_range(const bst_t *tree, int lo, int hi,
+		 binary_tree_visit_t func, void *ctx)
+{
+	const bst_t *node;
+	size_t count = 0;
+
+	if (!func || !clamp_high(tree, &hi) || lo > hi)
+		return (0);
+
+	for (node = bst_lower_bound(tree, lo); node && node->n <= hi;
+	     node = bst_successor(node))
+	{
+		count++;
+		if (func(node, ctx))
+			break;
+	}
+
+	return (count);
+}
+
+/**
+ * bst_range_page - Copies in order the values of a BST within a closed
+ * range into a buffer
+ * @tree: Pointer to the root node of the BST
+ * @lo: Lower bound of the range, included
+ * @hi: Upper bound of the range, included
+ * @buffer: Buffer receiving the values
+ * @limit: Maximum number of values to copy
+ *
+ * To read the next page, call again with @lo set to one past the last
+ * value copied. A page shorter than @limit is the last one.
+ *
+ * Return: Number of values copied
+ */
+size_t bst_range_page(const bst_t *tree, int lo, int hi, int *buffer,
+		      size_t limit)
+{
+	const bst_t *node;
+	size_t count = 0;
+
+	if (!buffer || !clamp_high(tree, &hi) || lo > hi)
+		return (0);
+
+	for (node = bst_lower_bound(tree, lo); count < limit && node &&
+	     node->n <= hi; node = bst_successor(node))
+		buffer[count++] = node->n;
+
+	return (count);
+}
+
+/**
+ * clamp_high - Lowers the upper bound of a range to the greatest value of
+ * a BST
+ * @tree: Pointer to the root node of the BST, possibly a subtree
+ * @hi: Pointer to the upper bound of the range
+ *
+ * Return: true if @tree is not empty, false otherwise
+ */
+static bool clamp_high(const bst_t *tree, int *hi)
+{
+	const bst_t *last;
+
+	if (!tree)
+		return (false);
+
+	for (last = tree; last->right; last = last->right)
+		;
+	if (last->n < *hi)
+		*hi = last->n;
+
+	return (true);
+}
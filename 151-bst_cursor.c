@@ -0,0 +1,80 @@
+#include "binary_trees.h"
+
+/**
+ * bst_cursor_init - Attaches a cursor to a BST
+ * @cursor: Pointer to the cursor
+ * @tree: Pointer to the root node of the BST
+ *
+ * The cursor starts off any node; place it with bst_cursor_first,
+ * bst_cursor_last or bst_cursor_seek. Inserting into or removing from
+ * the tree invalidates it, since nodes may move or be freed.
+ */
+void bst_cursor_init(bst_cursor_t *cursor, const bst_t *tree)
+{
+	if (!cursor)
+		return;
+
+	cursor->root = tree;
+	cursor->node = NULL;
+}
+
+/**
+ * bst_cursor_first - Moves a cursor to the smallest value of its BST
+ * @cursor: Pointer to the cursor
+ *
+ * Return: Pointer to the node under the cursor, or NULL if the tree is empty
+ */
+bst_t *bst_cursor_first(bst_cursor_t *cursor)
+{
+	const bst_t *node;
+
+	if (!cursor)
+		return (NULL);
+
+	node = cursor->root;
+	while (node && node->left)
+		node = node->left;
+	cursor->node = node;
+
+	return ((bst_t *)node);
+}
+
+/**
+ * bst_cursor_last - Moves a cursor to the largest value of its BST
+ * @cursor: Pointer to the cursor
+ *
+ * Return: Pointer to the node under the cursor, or NULL if the tree is empty
+ */
+bst_t *bst_cursor_last(bst_cursor_t *cursor)
+{
+	const bst_t *node;
+
+	if (!cursor)
+		return (NULL);
+
+	node = cursor->root;
+	while (node && node->right)
+		node = node->right;
+	cursor->node = node;
+
+	return ((bst_t *)node);
+}
+
+/**
+ * bst_cursor_seek - Moves a cursor to the smallest value of its BST that
+ * is not less than a given value
+ * @cursor: Pointer to the cursor
+ * @value: Value to compare with
+ *
+ * Return: Pointer to the node under the cursor, or NULL if every value is
+ * less than @value
+ */
+bst_t *bst_cursor_seek(bst_cursor_t *cursor, int value)
+{
+	if (!cursor)
+		return (NULL);
+
+	cursor->node = bst_lower_bound(cursor->root, value);
+
+	return ((bst_t *)cursor->node);
+}
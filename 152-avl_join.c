@@ -0,0 +1,130 @@
+#include "binary_trees.h"
+
+static avl_t *attach(avl_t *lo, avl_t *pivot, avl_t *hi);
+static avl_t *fix_up(avl_t *node);
+
+/**
+ * avl_join - Joins two AVL trees around a pivot node
+ * @lo: Pointer to the root of the AVL tree holding the smaller keys
+ * @pivot: Pointer to a detached node whose key is greater than every key
+ * of @lo and smaller than every key of @hi, NULL to concatenate the trees
+ * @hi: Pointer to the root of the AVL tree holding the greater keys
+ *
+ * When the heights of the trees differ by more than one, the pivot takes
+ * the place of the first node down the inner spine of the taller tree
+ * that is at most one level taller than the shorter tree, with that node
+ * and the shorter tree as children. The subtree grows by one level there,
+ * as after an insertion, and the ancestors are rebalanced on the way back
+ * up. The cached heights make the work O(|height(lo) - height(hi)| + 1),
+ * O(log(n)) at most.
+ *
+ * Return: Pointer to the root of the joined AVL tree
+ */
+avl_t *avl_join(avl_t *lo, avl_t *pivot, avl_t *hi)
+{
+	avl_t *node, *parent = NULL;
+
+	if (!pivot)
+		return (avl_concat(lo, hi));
+	if (lo)
+		lo->parent = NULL;
+	if (hi)
+		hi->parent = NULL;
+
+	if (avl_height(lo) > avl_height(hi) + 1)
+	{
+		for (node = lo; avl_height(node) > avl_height(hi) + 1;
+		     node = node->right)
+			parent = node;
+		parent->right = attach(node, pivot, hi);
+	}
+	else if (avl_height(hi) > avl_height(lo) + 1)
+	{
+		for (node = hi; avl_height(node) > avl_height(lo) + 1;
+		     node = node->left)
+			parent = node;
+		parent->left = attach(lo, pivot, node);
+	}
+	else
+		return (attach(lo, pivot, hi));
+
+	pivot->parent = parent;
+
+	return (fix_up(parent));
+}
+
+/**
+ * avl_concat - Concatenates two AVL trees
+ * @lo: Pointer to the root of the AVL tree holding the smaller keys
+ * @hi: Pointer to the root of the AVL tree holding the greater keys
+ *
+ * The greatest node of @lo is unlinked and used as the pivot of avl_join,
+ * which keeps the work in O(log(n)).
+ *
+ * Return: Pointer to the root of the concatenated AVL tree
+ */
+avl_t *avl_concat(avl_t *lo, avl_t *hi)
+{
+	avl_t *last;
+
+	if (!lo || !hi)
+		return (lo ? lo : hi);
+
+	for (last = lo; last->right; last = last->right)
+		;
+	if (last->left)
+		last->left->parent = last->parent;
+	if (last->parent)
+	{
+		last->parent->right = last->left;
+		lo = fix_up(last->parent);
+	}
+	else
+		lo = last->left;
+
+	return (avl_join(lo, last, hi));
+}
+
+/**
+ * attach - Makes a node the root of two AVL trees of close heights
+ * @lo: Pointer to the new left subtree
+ * @pivot: Pointer to the node
+ * @hi: Pointer to the new right subtree
+ *
+ * Return: Pointer to @pivot, with its cached height and size refreshed
+ */
+static avl_t *attach(avl_t *lo, avl_t *pivot, avl_t *hi)
+{
+	pivot->parent = NULL;
+	pivot->left = lo;
+	pivot->right = hi;
+	if (lo)
+		lo->parent = pivot;
+	if (hi)
+		hi->parent = pivot;
+	avl_update_height(pivot);
+	bst_update_size(pivot);
+
+	return (pivot);
+}
+
+/**
+ * fix_up - Refreshes and rebalances every node from a node up to the root
+ * @node: Pointer to the lowest node whose subtree changed
+ *
+ * Unlike avl_retrace, the walk never stops early: every ancestor gained
+ * or lost nodes, so every cached size must be refreshed.
+ *
+ * Return: Pointer to the root of the AVL tree
+ */
+static avl_t *fix_up(avl_t *node)
+{
+	while (1)
+	{
+		bst_update_size(node);
+		node = avl_rebalance(node);
+		if (!node->parent)
+			return (node);
+		node = node->parent;
+	}
+}
@@ -0,0 +1,60 @@
+#include "binary_trees.h"
+
+/**
+ * avl_split - Splits an AVL tree around a key
+ * @tree: Pointer to the root node of the AVL tree, consumed by the split
+ * @key: Key to split around
+ * @lo: Pointer receiving the AVL tree of the keys smaller than @key
+ * @hi: Pointer receiving the AVL tree of the keys greater than @key
+ *
+ * The search path to @key is taken apart on the way down, and on the way
+ * back up each node of the path is joined with the subtree it kept on the
+ * other side of @key, using the node itself as the pivot of avl_join. The
+ * joins on each side have heights that only grow, so their costs add up
+ * to O(log(n)).
+ *
+ * Return: Pointer to the detached node holding @key, with no parent and
+ * no children, or NULL if @key is not in the tree
+ */
+avl_t *avl_split(avl_t *tree, int key, avl_t **lo, avl_t **hi)
+{
+	avl_t *left, *right, *found;
+
+	if (!lo || !hi)
+		return (NULL);
+
+	*lo = NULL;
+	*hi = NULL;
+	if (!tree)
+		return (NULL);
+
+	left = tree->left;
+	right = tree->right;
+	tree->parent = NULL;
+	tree->left = NULL;
+	tree->right = NULL;
+	if (left)
+		left->parent = NULL;
+	if (right)
+		right->parent = NULL;
+
+	if (key < tree->n)
+	{
+		found = avl_split(left, key, lo, hi);
+		*hi = avl_join(*hi, tree, right);
+		return (found);
+	}
+	if (key > tree->n)
+	{
+		found = avl_split(right, key, lo, hi);
+		*lo = avl_join(left, tree, *lo);
+		return (found);
+	}
+
+	*lo = left;
+	*hi = right;
+	avl_update_height(tree);
+	bst_update_size(tree);
+
+	return (tree);
+}
@@ -0,0 +1,76 @@
+#include "binary_trees.h"
+
+static avl_t *start(avl_set_op_t op, avl_t *a, avl_t *b, size_t threads);
+
+/**
+ * avl_union - Merges two AVL trees into the AVL tree of all their keys
+ * @a: Pointer to the root of the first AVL tree, consumed
+ * @b: Pointer to the root of the second AVL tree, consumed
+ * @threads: Number of threads to use, 0 for one per online processor
+ *
+ * The nodes of the result are taken from @a and @b, and duplicate nodes
+ * are freed, so no node is allocated. See avl_set_combine for the
+ * algorithm.
+ *
+ * Return: Pointer to the root of the resulting AVL tree
+ */
+avl_t *avl_union(avl_t *a, avl_t *b, size_t threads)
+{
+	return (start(AVL_SET_UNION, a, b, threads));
+}
+
+/**
+ * avl_intersection - Reduces two AVL trees to the AVL tree of their
+ * common keys
+ * @a: Pointer to the root of the first AVL tree, consumed
+ * @b: Pointer to the root of the second AVL tree, consumed
+ * @threads: Number of threads to use, 0 for one per online processor
+ *
+ * The nodes of the result are taken from @a, the others are freed.
+ *
+ * Return: Pointer to the root of the resulting AVL tree
+ */
+avl_t *avl_intersection(avl_t *a, avl_t *b, size_t threads)
+{
+	return (start(AVL_SET_INTERSECTION, a, b, threads));
+}
+
+/**
+ * avl_difference - Removes the keys of an AVL tree from another one
+ * @a: Pointer to the root of the AVL tree to remove keys from, consumed
+ * @b: Pointer to the root of the AVL tree of the keys to remove, consumed
+ * @threads: Number of threads to use, 0 for one per online processor
+ *
+ * The nodes of the result are taken from @a, the others are freed.
+ *
+ * Return: Pointer to the root of the resulting AVL tree
+ */
+avl_t *avl_difference(avl_t *a, avl_t *b, size_t threads)
+{
+	return (start(AVL_SET_DIFFERENCE, a, b, threads));
+}
+
+/**
+ * start - Settles the thread budget of a set operation and runs it
+ * @op: Operation to apply
+ * @a: Pointer to the root of the first AVL tree
+ * @b: Pointer to the root of the second AVL tree
+ * @threads: Number of threads to use, 0 for one per online processor
+ *
+ * Worker threads would not allocate from the node pool of the calling
+ * thread, so an active one forces a single thread.
+ *
+ * Return: Pointer to the root of the resulting AVL tree
+ */
+static avl_t *start(avl_set_op_t op, avl_t *a, avl_t *b, size_t threads)
+{
+	threads = thread_count(threads);
+	if (node_pool_active())
+		threads = 1;
+	if (a)
+		a->parent = NULL;
+	if (b)
+		b->parent = NULL;
+
+	return (avl_set_combine(op, a, b, threads));
+}
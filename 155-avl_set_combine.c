@@ -0,0 +1,155 @@
+#include <pthread.h>
+#include "binary_trees.h"
+
+/* Pairs of subtrees with fewer nodes than this are not worth a thread */
+#define SET_PARALLEL_CUTOFF 65536
+
+/**
+ * struct set_task_s - Pair of subtrees handed to another thread
+ *
+ * @op: Operation to apply
+ * @a: Pointer to the root of the first subtree
+ * @b: Pointer to the root of the second subtree
+ * @threads: Number of threads the pair may use
+ * @tree: Pointer to the root of the resulting subtree
+ */
+typedef struct set_task_s
+{
+	avl_set_op_t op;
+	avl_t *a;
+	avl_t *b;
+	size_t threads;
+	avl_t *tree;
+} set_task_t;
+
+static avl_t *settle(avl_set_op_t op, avl_t *a, avl_t *b);
+static avl_t *reattach(avl_set_op_t op, avl_t *root, avl_t *match,
+		       avl_t *lo, avl_t *hi);
+static void *combine_task(void *arg);
+
+/**
+ * avl_set_combine - Applies a set operation to two AVL subtrees
+ * @op: Operation to apply
+ * @a: Pointer to the root of the first AVL subtree, with no parent, consumed
+ * @b: Pointer to the root of the second AVL subtree, with no parent,
+ * consumed
+ * @threads: Number of threads the pair may use, at least 1
+ *
+ * The root of one tree, @b for a difference and @a otherwise, splits the
+ * other tree with avl_split. The two halves are combined with the
+ * matching children of the root, the left pair on a new thread while the
+ * current one takes the right pair as long as the thread budget lasts and
+ * the pair holds at least SET_PARALLEL_CUTOFF nodes, and the results are
+ * put back together around the root. Splits and joins cost O(log(n)),
+ * which makes the whole operation O(m log(n / m + 1)) for trees of
+ * m <= n nodes, so a small tree is merged into a large one without
+ * walking the large one. No node pool may be active with several threads.
+ *
+ * Return: Pointer to the root of the resulting AVL subtree
+ */
+avl_t *avl_set_combine(avl_set_op_t op, avl_t *a, avl_t *b, size_t threads)
+{
+	avl_t *root, *lo, *hi, *match, *left, *right;
+	set_task_t task;
+	pthread_t thread;
+	bool spawned = false, diff = op == AVL_SET_DIFFERENCE;
+
+	if (!a || !b)
+		return (settle(op, a, b));
+
+	task.threads = threads > 1 && bst_size(a) + bst_size(b) >=
+		       SET_PARALLEL_CUTOFF ? threads / 2 : 0;
+	threads -= task.threads;
+	root = diff ? b : a;
+	match = avl_split(diff ? a : b, root->n, &lo, &hi);
+	left = root->left;
+	right = root->right;
+	if (left)
+		left->parent = NULL;
+	if (right)
+		right->parent = NULL;
+
+	task.op = op;
+	task.a = diff ? lo : left;
+	task.b = diff ? left : lo;
+	task.tree = NULL;
+	if (task.threads)
+		spawned = !pthread_create(&thread, NULL, combine_task, &task);
+
+	right = diff ? avl_set_combine(op, hi, right, threads) :
+		avl_set_combine(op, right, hi, threads);
+	if (spawned)
+		pthread_join(thread, NULL);
+	else
+		combine_task(&task);
+
+	return (reattach(op, root, match, task.tree, right));
+}
+
+/**
+ * settle - Applies a set operation when one of the trees is empty
+ * @op: Operation to apply
+ * @a: Pointer to the root of the first AVL subtree, consumed
+ * @b: Pointer to the root of the second AVL subtree, consumed
+ *
+ * Return: Pointer to the root of the resulting AVL subtree
+ */
+static avl_t *settle(avl_set_op_t op, avl_t *a, avl_t *b)
+{
+	if (op == AVL_SET_UNION)
+		return (a ? a : b);
+
+	binary_tree_delete(b);
+	if (op == AVL_SET_DIFFERENCE)
+		return (a);
+
+	binary_tree_delete(a);
+
+	return (NULL);
+}
+
+/**
+ * reattach - Puts the combined halves back together around the root
+ * @op: Operation applied
+ * @root: Pointer to the detached node that split the other tree
+ * @match: Pointer to the detached node of the other tree holding the key
+ * of @root, or NULL if there is none
+ * @lo: Pointer to the root of the combined keys below the key of @root
+ * @hi: Pointer to the root of the combined keys above the key of @root
+ *
+ * The root is kept as the pivot of avl_join when its key belongs to the
+ * result, and freed otherwise, the halves being joined with avl_concat.
+ * @match is always freed.
+ *
+ * Return: Pointer to the root of the resulting AVL subtree
+ */
+static avl_t *reattach(avl_set_op_t op, avl_t *root, avl_t *match,
+		       avl_t *lo, avl_t *hi)
+{
+	bool keep = op == AVL_SET_UNION || (op == AVL_SET_INTERSECTION && match);
+
+	if (match)
+		binary_tree_node_free(match);
+	if (keep)
+		return (avl_join(lo, root, hi));
+
+	binary_tree_node_free(root);
+
+	return (avl_concat(lo, hi));
+}
+
+/**
+ * combine_task - Thread entry point combining the subtrees of a task
+ * @arg: Pointer to the set_task_t to fill
+ *
+ * Return: Always NULL, the subtree is stored in the task
+ */
+static void *combine_task(void *arg)
+{
+	set_task_t *task = arg;
+
+	task->tree = avl_set_combine(task->op, task->a, task->b,
+				     task->threads ? task->threads : 1);
+
+	return (NULL);
+}
@@ -0,0 +1,68 @@
+#include "binary_trees.h"
+
+/**
+ * bst_cursor_next - Moves a cursor to the next value of its BST
+ * @cursor: Pointer to the cursor
+ *
+ * The next node is the leftmost node of the right subtree, or else the
+ * nearest ancestor reached from a left child. The climb stops at the root
+ * of the cursor, so a cursor on a subtree of a larger BST never walks
+ * into its ancestors. Moving past the largest value leaves the cursor off
+ * any node, where both bst_cursor_next and bst_cursor_prev return NULL.
+ * Walking the whole tree costs O(1) amortized per step.
+ *
+ * Return: Pointer to the node under the cursor, or NULL if there is none
+ */
+bst_t *bst_cursor_next(bst_cursor_t *cursor)
+{
+	const bst_t *node;
+
+	if (!cursor || !cursor->node)
+		return (NULL);
+
+	node = cursor->node;
+	if (node->right)
+		node = bst_successor(node);
+	else
+	{
+		while (node != cursor->root && node->parent->right == node)
+			node = node->parent;
+		node = node == cursor->root ? NULL : node->parent;
+	}
+	cursor->node = node;
+
+	return ((bst_t *)node);
+}
+
+/**
+ * bst_cursor_prev - Moves a cursor to the previous value of its BST
+ * @cursor: Pointer to the cursor
+ *
+ * The previous node is the rightmost node of the left subtree, or else
+ * the nearest ancestor reached from a right child, without climbing past
+ * the root of the cursor. Moving past the smallest value leaves the
+ * cursor off any node, where both bst_cursor_next and bst_cursor_prev
+ * return NULL.
+ *
+ * Return: Pointer to the node under the cursor, or NULL if there is none
+ */
+bst_t *bst_cursor_prev(bst_cursor_t *cursor)
+{
+	const bst_t *node;
+
+	if (!cursor || !cursor->node)
+		return (NULL);
+
+	node = cursor->node;
+	if (node->left)
+		node = bst_predecessor(node);
+	else
+	{
+		while (node != cursor->root && node->parent->left == node)
+			node = node->parent;
+		node = node == cursor->root ? NULL : node->parent;
+	}
+	cursor->node = node;
+
+	return ((bst_t *)node);
+}
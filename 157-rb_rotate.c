@@ -0,0 +1,34 @@
+#include "binary_trees.h"
+
+/**
+ * rb_child - Reads the child of a red-black tree node on a given side.
+ * @node: Pointer to the node.
+ * @dir: 0 for the left child, 1 for the right child.
+ *
+ * Return: Pointer to the child, which may be NULL.
+ */
+rb_t *rb_child(const rb_t *node, int dir)
+{
+	return (dir ? node->right : node->left);
+}
+
+/**
+ * rb_rotate - Rotates a red-black subtree and relinks it to its parent.
+ * @root: Pointer to the root pointer of the tree, updated when needed.
+ * @node: Pointer to the root of the subtree to rotate.
+ * @dir: 0 to rotate left, 1 to rotate right.
+ */
+void rb_rotate(rb_t **root, rb_t *node, int dir)
+{
+	rb_t *parent = node->parent, *pivot;
+
+	pivot = dir ? binary_tree_rotate_right(node)
+		    : binary_tree_rotate_left(node);
+
+	if (!parent)
+		*root = pivot;
+	else if (parent->left == node)
+		parent->left = pivot;
+	else
+		parent->right = pivot;
+}
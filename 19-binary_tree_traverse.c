@@ -0,0 +1,160 @@
+#include "binary_trees.h"
+
+/**
+ * struct value_visit_s - Adapts a callback taking values to
+ * binary_tree_visit_t
+ *
+ * @func: Pointer to the function to call with the value of each node
+ */
+typedef struct value_visit_s
+{
+	void (*func)(int);
+} value_visit_t;
+
+static int visit_value(const binary_tree_t *node, void *ctx);
+static bool visit(const binary_tree_t *node, binary_tree_visit_t func,
+		  void *ctx, size_t *count);
+
+/**
+ * binary_tree_traverse - Traverses a binary tree with a chosen strategy
+ * @tree: Pointer to the root node of the tree to traverse
+ * @order: Pre-order, in-order or post-order
+ * @mode: Recursive, parent-pointer walk or Morris threading
+ * @func: Pointer to a function to call for each node
+ *
+ * The recursive mode uses one stack frame per level and can overflow the
+ * stack on degenerate trees. The parent and Morris modes run in O(n) time
+ * with O(1) extra space whatever the shape of the tree.
+ */
+void binary_tree_traverse(const binary_tree_t *tree, traversal_order_t order,
+			  traversal_mode_t mode, void (*func)(int))
+{
+	if (!tree || !func)
+		return;
+
+	if (mode == TRAVERSAL_PARENT)
+		binary_tree_traverse_parent(tree, order, func);
+	else if (mode == TRAVERSAL_MORRIS)
+		binary_tree_traverse_morris(tree, order, func);
+	else if (order == TRAVERSAL_PREORDER)
+		binary_tree_preorder(tree, func);
+	else if (order == TRAVERSAL_INORDER)
+		binary_tree_inorder(tree, func);
+	else
+		binary_tree_postorder(tree, func);
+}
+
+/**
+ * binary_tree_traverse_parent - Traverses a binary tree iteratively
+ * through the parent pointers
+ * @tree: Pointer to the root node of the tree to traverse
+ * @order: Pre-order, in-order or post-order
+ * @func: Pointer to a function to call for each node
+ *
+ * The previously visited node tells whether the walk is coming down from
+ * the parent, back up from the left child or back up from the right child,
+ * so no stack is needed. The parent pointers of the tree must be correct.
+ */
+void binary_tree_traverse_parent(const binary_tree_t *tree,
+				 traversal_order_t order, void (*func)(int))
+{
+	value_visit_t adapter;
+
+	if (!func)
+		return;
+
+	adapter.func = func;
+	binary_tree_traverse_ctx(tree, order, visit_value, &adapter);
+}
+
+/**
+ * binary_tree_traverse_ctx - Traverses a binary tree iteratively through
+ * the parent pointers, with a callback that can stop the walk
+ * @tree: Pointer to the root node of the tree to traverse
+ * @order: Pre-order, in-order or post-order
+ * @func: Pointer to the function to call for each node, returning
+ * nonzero to stop the walk
+ * @ctx: Pointer passed to @func as is
+ *
+ * The previously visited node tells whether the walk is coming down from
+ * the parent, back up from the left child or back up from the right child,
+ * so no stack is needed. The parent pointers of the tree must be correct.
+ * Since nothing is left to unwind, the walk ends as soon as @func asks.
+ *
+ * Return: Number of nodes passed to @func
+ */
+size_t binary_tree_traverse_ctx(const binary_tree_t *tree,
+				traversal_order_t order,
+				binary_tree_visit_t func, void *ctx)
+{
+	const binary_tree_t *node, *prev, *next, *stop;
+	size_t count = 0;
+
+	if (!tree || !func)
+		return (0);
+
+	stop = tree->parent;
+	for (prev = stop, node = tree; node != stop; prev = node, node = next)
+	{
+		if (prev == node->parent)
+		{
+			if (order == TRAVERSAL_PREORDER &&
+			    visit(node, func, ctx, &count))
+				break;
+			if (node->left)
+			{
+				next = node->left;
+				continue;
+			}
+		}
+
+		if (prev != node->right || !node->right)
+		{
+			if (order == TRAVERSAL_INORDER &&
+			    visit(node, func, ctx, &count))
+				break;
+			if (node->right)
+			{
+				next = node->right;
+				continue;
+			}
+		}
+
+		if (order == TRAVERSAL_POSTORDER && visit(node, func, ctx, &count))
+			break;
+		next = node->parent;
+	}
+
+	return (count);
+}
+
+/**
+ * visit - Passes a node to a callback and counts it
+ * @node: Pointer to the node
+ * @func: Pointer to the callback
+ * @ctx: Pointer passed to @func as is
+ * @count: Pointer to the number of visited nodes, incremented
+ *
+ * Return: true if @func asks to stop the walk, false otherwise
+ */
+static bool visit(const binary_tree_t *node, binary_tree_visit_t func,
+		  void *ctx, size_t *count)
+{
+	(*count)++;
+
+	return (func(node, ctx) != 0);
+}
+
+/**
+ * visit_value - Passes the value of a node to a value_visit_t callback
+ * @node: Pointer to the node
+ * @ctx: Pointer to the value_visit_t
+ *
+ * Return: Always 0, to visit the whole tree
+ */
+static int visit_value(const binary_tree_t *node, void *ctx)
+{
+	((value_visit_t *)ctx)->func(node->n);
+
+	return (0);
+}
@@ -0,0 +1,135 @@
+#include "binary_trees.h"
+
+static void morris_pre_in(binary_tree_t *node, traversal_order_t order,
+			  void (*func)(int));
+static void morris_post(binary_tree_t *root, void (*func)(int));
+static binary_tree_t *reverse_right_path(binary_tree_t *from);
+
+/**
+ * binary_tree_traverse_morris - Traverses a binary tree by Morris threading
+ * @tree: Pointer to the root node of the tree to traverse
+ * @order: Pre-order, in-order or post-order
+ * @func: Pointer to a function to call for each node
+ *
+ * Empty right links of in-order predecessors are temporarily pointed back
+ * at their successors, which replaces the stack. Every link is restored
+ * before returning, but the tree must not be read concurrently while the
+ * traversal runs. Parent pointers are neither used nor modified.
+ */
+void binary_tree_traverse_morris(const binary_tree_t *tree,
+				 traversal_order_t order, void (*func)(int))
+{
+	if (!tree || !func)
+		return;
+
+	if (order == TRAVERSAL_POSTORDER)
+		morris_post((binary_tree_t *)tree, func);
+	else
+		morris_pre_in((binary_tree_t *)tree, order, func);
+}
+
+/**
+ * morris_pre_in - Morris pre-order or in-order traversal
+ * @node: Pointer to the root node of the tree to traverse
+ * @order: TRAVERSAL_PREORDER or TRAVERSAL_INORDER
+ * @func: Pointer to a function to call for each node
+ */
+static void morris_pre_in(binary_tree_t *node, traversal_order_t order,
+			  void (*func)(int))
+{
+	binary_tree_t *pred;
+
+	while (node)
+	{
+		if (!node->left)
+		{
+			func(node->n);
+			node = node->right;
+			continue;
+		}
+
+		pred = node->left;
+		while (pred->right && pred->right != node)
+			pred = pred->right;
+
+		if (!pred->right)
+		{
+			if (order == TRAVERSAL_PREORDER)
+				func(node->n);
+			pred->right = node;
+			node = node->left;
+		}
+		else
+		{
+			if (order == TRAVERSAL_INORDER)
+				func(node->n);
+			pred->right = NULL;
+			node = node->right;
+		}
+	}
+}
+
+/**
+ * morris_post - Morris post-order traversal
+ * @root: Pointer to the root node of the tree to traverse
+ * @func: Pointer to a function to call for each node
+ *
+ * A dummy node adopts the tree as its left child. Each time a thread is
+ * removed, the right path from the left child of the current node down to
+ * the predecessor is reversed, visited bottom-up, and reversed back.
+ */
+static void morris_post(binary_tree_t *root, void (*func)(int))
+{
+	binary_tree_t dummy, *node, *pred, *walk;
+
+	memset(&dummy, 0, sizeof(dummy));
+	dummy.left = root;
+
+	for (node = &dummy; node;)
+	{
+		if (!node->left)
+		{
+			node = node->right;
+			continue;
+		}
+
+		pred = node->left;
+		while (pred->right && pred->right != node)
+			pred = pred->right;
+
+		if (!pred->right)
+		{
+			pred->right = node;
+			node = node->left;
+			continue;
+		}
+
+		pred->right = NULL;
+		walk = reverse_right_path(node->left);
+		for (pred = walk; pred; pred = pred->right)
+			func(pred->n);
+		reverse_right_path(walk);
+		node = node->right;
+	}
+}
+
+/**
+ * reverse_right_path - Reverses the chain of right links below a node
+ * @from: First node of the chain, whose last node has no right child
+ *
+ * Return: Pointer to the former last node, now first in the chain
+ */
+static binary_tree_t *reverse_right_path(binary_tree_t *from)
+{
+	binary_tree_t *prev = NULL, *next;
+
+	while (from)
+	{
+		next = from->right;
+		from->right = prev;
+		prev = from;
+		from = next;
+	}
+
+	return (prev);
+}
@@ -0,0 +1,115 @@
+#include "binary_trees.h"
+
+/**
+ * queue_init - Initializes an empty queue.
+ *
+ * @queue: A pointer to the queue to initialize.
+ * @scratch: Optional caller-provided buffer to start with (may be NULL).
+ * @capacity: Number of slots in @scratch.
+ * The queue only allocates once it holds more than @capacity elements,
+ * and never frees @scratch.
+ */
+void queue_init(queue_t *queue, void **scratch, size_t capacity)
+{
+	if (!queue)
+		return;
+
+	queue->buffer = scratch;
+	queue->capacity = scratch ? capacity : 0;
+	queue->head = 0;
+	queue->size = 0;
+	queue->owned = false;
+}
+
+/**
+ * queue_push - Adds an element to the rear of the queue.
+ *
+ * When the buffer is full, a buffer twice as large is allocated and the
+ * elements are copied to its start in FIFO order.
+ *
+ * @queue: A pointer to the queue to which the element will be added.
+ * @data: A pointer to the data to be stored in the queue.
+ * Return: true on success, false if memory allocation fails.
+ */
+bool queue_push(queue_t *queue, void *data)
+{
+	void **buffer;
+	size_t i, capacity;
+
+	if (queue->size == queue->capacity)
+	{
+		capacity = queue->capacity ? queue->capacity * 2 : QUEUE_SCRATCH_SIZE;
+		buffer = malloc(sizeof(void *) * capacity);
+		if (!buffer)
+		{
+			fprintf(stderr, "Memory allocation failed. Unable to enqueue!\n");
+			return (false);
+		}
+
+		for (i = 0; i < queue->size; i++)
+			buffer[i] = queue->buffer[(queue->head + i) % queue->capacity];
+
+		if (queue->owned)
+			free(queue->buffer);
+		queue->buffer = buffer;
+		queue->capacity = capacity;
+		queue->head = 0;
+		queue->owned = true;
+	}
+
+	queue->buffer[(queue->head + queue->size) % queue->capacity] = data;
+	queue->size++;
+
+	return (true);
+}
+
+/**
+ * queue_pop - Removes and returns the element at the front of the queue.
+ *
+ * @queue: A pointer to the queue from which the element will be removed.
+ * Return: A pointer to the data of the removed element,
+ * or NULL if the queue is empty.
+ */
+void *queue_pop(queue_t *queue)
+{
+	void *data;
+
+	if (!queue->size)
+		return (NULL);
+
+	data = queue->buffer[queue->head];
+	queue->head = (queue->head + 1) % queue->capacity;
+	queue->size--;
+
+	return (data);
+}
+
+/**
+ * queue_is_empty - Checks if the queue is empty.
+ *
+ * @queue: A pointer to the queue to be checked.
+ * Return: true if the queue is empty, false otherwise.
+ */
+bool queue_is_empty(const queue_t *queue)
+{
+	return (!queue->size);
+}
+
+/**
+ * queue_free - Releases the buffer allocated by a queue.
+ *
+ * A caller-provided scratch buffer is left alone. The queue is left
+ * empty and can be reused.
+ *
+ * @queue: A pointer to the queue to release.
+ */
+void queue_free(queue_t *queue)
+{
+	if (!queue)
+		return;
+
+	if (queue->owned)
+		free(queue->buffer);
+
+	queue_init(queue, NULL, 0);
+}
@@ -0,0 +1,108 @@
+#include "binary_trees.h"
+
+/**
+ * node_pool_create - Creates an empty node pool
+ * @slab_size: Number of nodes per slab (0 selects a default of 4096)
+ *
+ * Return: Pointer to the new pool, or NULL on failure
+ */
+node_pool_t *node_pool_create(size_t slab_size)
+{
+	node_pool_t *pool = malloc(sizeof(node_pool_t));
+
+	if (!pool)
+		return (NULL);
+
+	pool->slabs = NULL;
+	pool->slab_count = 0;
+	pool->current = NULL;
+	pool->free_list = NULL;
+	pool->slab_size = slab_size ? slab_size : 4096;
+	pool->used = pool->slab_size;
+
+	return (pool);
+}
+
+/**
+ * node_pool_alloc - Takes an uninitialized node from a pool
+ * @pool: Pointer to the pool
+ *
+ * Released nodes are reused first; otherwise the node is carved out of
+ * the current slab, and a new slab is allocated when it is exhausted.
+ *
+ * Return: Pointer to the node, or NULL on failure
+ */
+binary_tree_t *node_pool_alloc(node_pool_t *pool)
+{
+	binary_tree_t *node;
+
+	if (!pool)
+		return (NULL);
+
+	if (pool->free_list)
+	{
+		node = pool->free_list;
+		pool->free_list = node->parent;
+		return (node);
+	}
+
+	if (pool->used == pool->slab_size && !node_pool_add_slab(pool))
+		return (NULL);
+
+	return (pool->current + pool->used++);
+}
+
+/**
+ * node_pool_release - Gives a node back to its pool for reuse
+ * @pool: Pointer to the pool the node was taken from
+ * @node: Pointer to the node to release
+ */
+void node_pool_release(node_pool_t *pool, binary_tree_t *node)
+{
+	if (!pool || !node)
+		return;
+
+	node->parent = pool->free_list;
+	pool->free_list = node;
+}
+
+/**
+ * node_pool_reset - Releases every node of a pool at once
+ * @pool: Pointer to the pool
+ *
+ * All the slabs are freed, which releases every tree built against the
+ * pool without walking them. The pool itself stays usable.
+ */
+void node_pool_reset(node_pool_t *pool)
+{
+	size_t i;
+
+	if (!pool)
+		return;
+
+	for (i = 0; i < pool->slab_count; i++)
+		free(pool->slabs[i]);
+	free(pool->slabs);
+
+	pool->slabs = NULL;
+	pool->slab_count = 0;
+	pool->current = NULL;
+	pool->free_list = NULL;
+	pool->used = pool->slab_size;
+}
+
+/**
+ * node_pool_destroy - Releases every node of a pool and the pool itself
+ * @pool: Pointer to the pool
+ */
+void node_pool_destroy(node_pool_t *pool)
+{
+	if (!pool)
+		return;
+
+	if (node_pool_active() == pool)
+		node_pool_use(NULL);
+
+	node_pool_reset(pool);
+	free(pool);
+}
@@ -0,0 +1,28 @@
+#include "binary_trees.h"
+
+static __thread node_pool_t *active_pool;
+
+/**
+ * node_pool_use - Selects the pool binary_tree_node allocates from
+ * @pool: Pointer to the pool, or NULL to go back to malloc and free
+ *
+ * The selection only applies to the calling thread; other threads keep
+ * their own. Every node must be released by a thread whose active pool
+ * is the one it came from, which binary_tree_node_free asserts. A pool
+ * itself is not thread-safe and must be active in one thread at a time.
+ */
+void node_pool_use(node_pool_t *pool)
+{
+	active_pool = pool;
+}
+
+/**
+ * node_pool_active - Reads the pool binary_tree_node allocates from
+ * in the calling thread
+ *
+ * Return: Pointer to the active pool, or NULL if nodes use malloc
+ */
+node_pool_t *node_pool_active(void)
+{
+	return (active_pool);
+}
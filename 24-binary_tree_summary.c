@@ -0,0 +1,95 @@
+#include "binary_trees.h"
+
+/**
+ * binary_tree_summary - Measures a binary tree in a single traversal
+ * @tree: Pointer to the root node of the tree
+ * @summary: Pointer to the summary to fill; @summary->depths and
+ * @summary->depths_size must be set by the caller beforehand
+ *
+ * Every node is counted once by summary_walk, with its depth and its level
+ * order index: the tree is complete when the largest index equals its
+ * size, and perfect when it is complete and its size is one less than a
+ * power of two.
+ *
+ * Return: 1 on success, 0 if @summary is NULL or on allocation failure
+ */
+int binary_tree_summary(const binary_tree_t *tree,
+			binary_tree_summary_t *summary)
+{
+	summary_part_t part;
+
+	if (!summary)
+		return (0);
+
+	summary_part_init(&part, summary->depths, summary->depths_size);
+	part.root.node = tree;
+	summary_walk(&part, part.root);
+
+	return (summary_finish(summary, &part));
+}
+
+/**
+ * summary_part_init - Prepares an empty part of a summary
+ * @part: Pointer to the part
+ * @depths: Buffer receiving the depth histogram, cleared, or NULL
+ * @depths_size: Number of entries in @depths
+ *
+ * The root frame of the part is set to the root of a whole tree, with no
+ * node yet.
+ */
+void summary_part_init(summary_part_t *part, size_t *depths,
+		       size_t depths_size)
+{
+	memset(part, 0, sizeof(*part));
+	part->counts.is_full = true;
+	part->counts.depths = depths;
+	part->counts.depths_size = depths ? depths_size : 0;
+	if (depths)
+		memset(depths, 0, sizeof(*depths) * part->counts.depths_size);
+	part->root.index = 1;
+}
+
+/**
+ * summary_merge - Adds the metrics of a part to another
+ * @top: Pointer to the part receiving the metrics
+ * @part: Pointer to the part to add
+ */
+void summary_merge(summary_part_t *top, const summary_part_t *part)
+{
+	size_t i;
+
+	top->counts.size += part->counts.size;
+	top->counts.leaves += part->counts.leaves;
+	top->counts.internal += part->counts.internal;
+	if (part->counts.height > top->counts.height)
+		top->counts.height = part->counts.height;
+	if (part->max_index > top->max_index)
+		top->max_index = part->max_index;
+	top->counts.is_full = top->counts.is_full && part->counts.is_full;
+	top->failed = top->failed || part->failed;
+
+	for (i = 0; part->counts.depths && i < top->counts.depths_size; i++)
+		top->counts.depths[i] += part->counts.depths[i];
+}
+
+/**
+ * summary_finish - Fills a summary from the metrics of a whole tree
+ * @summary: Pointer to the summary
+ * @part: Pointer to the part holding the metrics of the whole tree
+ *
+ * Return: 1 if every walk of the tree succeeded, 0 otherwise
+ */
+int summary_finish(binary_tree_summary_t *summary, const summary_part_t *part)
+{
+	size_t size = part->counts.size;
+
+	summary->size = size;
+	summary->height = part->counts.height;
+	summary->leaves = part->counts.leaves;
+	summary->internal = part->counts.internal;
+	summary->is_full = size && part->counts.is_full;
+	summary->is_complete = size && part->max_index == size;
+	summary->is_perfect = summary->is_complete && !((size + 1) & size);
+
+	return (!part->failed);
+}
@@ -0,0 +1,178 @@
+#include "binary_trees.h"
+
+/* Bytes gathered before each fwrite */
+#define SAVE_BUFFER_SIZE 65536
+
+/**
+ * struct save_ctx_s - State of a tree being written
+ *
+ * @stream: Stream receiving the file
+ * @buffer: Bytes waiting to be written
+ * @used: Number of bytes in @buffer
+ * @prev: Previously written node, to check the order of sorted keys
+ * @sorted: true if the keys must be strictly increasing
+ * @nibble: Shape nibble of the previous node while it waits for a pair
+ * @count: Number of nodes visited by the current walk
+ * @failed: true if a write failed or the keys were out of order
+ */
+typedef struct save_ctx_s
+{
+	FILE *stream;
+	unsigned char buffer[SAVE_BUFFER_SIZE];
+	size_t used;
+	const binary_tree_t *prev;
+	bool sorted;
+	unsigned char nibble;
+	size_t count;
+	bool failed;
+} save_ctx_t;
+
+static int save_shape(const binary_tree_t *node, void *ctx);
+static int save_key(const binary_tree_t *node, void *ctx);
+static bool emit(save_ctx_t *ctx, const void *data, size_t size);
+static bool flush(save_ctx_t *ctx);
+
+/**
+ * binary_tree_save - Writes a binary tree to a stream in the tree file format
+ * @tree: Pointer to the root node of the tree, NULL for an empty tree
+ * @stream: Stream to write to
+ * @format: TREE_FORMAT_SORTED for a BST or an AVL tree, TREE_FORMAT_SHAPE
+ * to keep the exact shape and colors of any binary tree
+ *
+ * A first walk with binary_tree_summary counts the nodes for the header, then the shape nibbles and
+ * the keys are produced by walks through the parent pointers and written
+ * in large blocks, so the stream does not need to be seekable and no copy
+ * of the tree is made. Everything is written in the host byte order, which
+ * the header records for binary_tree_load.
+ *
+ * Return: 1 on success, 0 on a write error, an invalid argument, or keys
+ * that are not strictly increasing in TREE_FORMAT_SORTED
+ */
+int binary_tree_save(const binary_tree_t *tree, FILE *stream,
+		     tree_format_t format)
+{
+	tree_file_header_t header;
+	binary_tree_summary_t summary;
+	save_ctx_t *ctx;
+	int saved;
+
+	summary.depths = NULL;
+	if (!stream || (unsigned int)format > TREE_FORMAT_SHAPE ||
+	    !binary_tree_summary(tree, &summary))
+		return (0);
+
+	ctx = calloc(1, sizeof(*ctx));
+	if (!ctx)
+		return (0);
+	ctx->stream = stream;
+	ctx->sorted = format == TREE_FORMAT_SORTED;
+
+	memcpy(header.magic, TREE_FILE_MAGIC, sizeof(header.magic));
+	header.version = TREE_FILE_VERSION;
+	header.format = format;
+	header.byte_order = TREE_FILE_BYTE_ORDER;
+	header.key_size = sizeof(int);
+	header.count = summary.size;
+	header.shape_size = format == TREE_FORMAT_SORTED ? 0 :
+			    ((header.count + 1) / 2 + 7) & ~(uint64_t)7;
+	emit(ctx, &header, sizeof(header));
+
+	if (format == TREE_FORMAT_SHAPE)
+	{
+		binary_tree_traverse_ctx(tree, TRAVERSAL_PREORDER, save_shape, ctx);
+		emit(ctx, &ctx->nibble, ctx->count % 2);
+		emit(ctx, "\0\0\0\0\0\0\0",
+		     header.shape_size - (header.count + 1) / 2);
+	}
+	binary_tree_traverse_ctx(tree, ctx->sorted ? TRAVERSAL_INORDER :
+				 TRAVERSAL_PREORDER, save_key, ctx);
+
+	saved = flush(ctx) && !ctx->failed && !fflush(stream);
+	free(ctx);
+
+	return (saved);
+}
+
+/**
+ * save_shape - Writes the shape nibble of a node, two nodes per byte
+ * @node: Pointer to the visited node
+ * @ctx: Pointer to the save_ctx_t
+ *
+ * Return: 0 to carry on, 1 to stop after a write error
+ */
+static int save_shape(const binary_tree_t *node, void *ctx)
+{
+	save_ctx_t *save = ctx;
+	unsigned char nibble;
+
+	nibble = (node->left ? 1 : 0) | (node->right ? 2 : 0) |
+		 (node->color == RB_BLACK ? 4 : 0);
+	if (save->count++ % 2 == 0)
+	{
+		save->nibble = nibble;
+		return (0);
+	}
+
+	save->nibble |= nibble << 4;
+
+	return (!emit(save, &save->nibble, 1));
+}
+
+/**
+ * save_key - Writes the key of a node
+ * @node: Pointer to the visited node
+ * @ctx: Pointer to the save_ctx_t
+ *
+ * Return: 0 to carry on, 1 to stop after a write error or a key out of order
+ */
+static int save_key(const binary_tree_t *node, void *ctx)
+{
+	save_ctx_t *save = ctx;
+
+	if (save->sorted && save->prev && save->prev->n >= node->n)
+	{
+		save->failed = true;
+		return (1);
+	}
+	save->prev = node;
+
+	return (!emit(save, &node->n, sizeof(node->n)));
+}
+
+/**
+ * emit - Appends bytes to the buffer, writing it out whenever it fills up
+ * @ctx: Pointer to the state of the writer
+ * @data: Pointer to the bytes
+ * @size: Number of bytes, less than SAVE_BUFFER_SIZE
+ *
+ * Return: true on success, false on a write error
+ */
+static bool emit(save_ctx_t *ctx, const void *data, size_t size)
+{
+	if (ctx->used + size > SAVE_BUFFER_SIZE && !flush(ctx))
+		return (false);
+
+	memcpy(ctx->buffer + ctx->used, data, size);
+	ctx->used += size;
+
+	return (true);
+}
+
+/**
+ * flush - Writes out the buffer of a writer
+ * @ctx: Pointer to the state of the writer
+ *
+ * Return: true on success, false on a write error
+ */
+static bool flush(save_ctx_t *ctx)
+{
+	if (ctx->failed)
+		return (false);
+
+	if (ctx->used && fwrite(ctx->buffer, 1, ctx->used, ctx->stream) !=
+	    ctx->used)
+		ctx->failed = true;
+	ctx->used = 0;
+
+	return (!ctx->failed);
+}
@@ -0,0 +1,256 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "binary_trees.h"
+
+/**
+ * struct load_slot_s - Link waiting for the next node of a shape file
+ *
+ * @parent: Pointer to the node owning the link, NULL for the root
+ * @link: Pointer to the child pointer to fill
+ */
+typedef struct load_slot_s
+{
+	binary_tree_t *parent;
+	binary_tree_t **link;
+} load_slot_t;
+
+static bool read_header(const void *map, size_t length,
+			tree_file_header_t *header, bool *swapped);
+static bool build(void *map, const tree_file_header_t *header,
+		  bool swapped, binary_tree_t **tree);
+static binary_tree_t *build_shape(const unsigned char *shape,
+				  const int *keys, size_t count, bool *ok);
+static void refresh(binary_tree_t *tree);
+
+/**
+ * binary_tree_load - Rebuilds a binary tree from a file written by
+ * binary_tree_save
+ * @path: Path of the file
+ * @tree: Pointer receiving the root node of the tree, NULL if the file
+ * holds an empty tree
+ *
+ * The file is mapped in memory rather than read and parsed, and the keys
+ * are used in place: a TREE_FORMAT_SORTED file is handed straight to
+ * sorted_array_to_avl_parallel, which builds a balanced AVL tree in O(n),
+ * and a TREE_FORMAT_SHAPE file is rebuilt node by node in pre-order, then
+ * its cached heights and sizes are set in one post-order walk. A file of
+ * the other byte order is swapped in a private copy of the mapping.
+ *
+ * Return: 1 on success, 0 if the file cannot be mapped, is not a valid
+ * tree file of a supported version, or on allocation failure
+ */
+int binary_tree_load(const char *path, binary_tree_t **tree)
+{
+	tree_file_header_t header;
+	struct stat st;
+	void *map;
+	bool swapped, ok = false;
+	int fd;
+
+	if (!path || !tree)
+		return (0);
+	*tree = NULL;
+
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return (0);
+	if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(header))
+	{
+		close(fd);
+		return (0);
+	}
+	map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return (0);
+	madvise(map, st.st_size, MADV_SEQUENTIAL);
+
+	if (read_header(map, st.st_size, &header, &swapped))
+		ok = build(map, &header, swapped, tree);
+	munmap(map, st.st_size);
+
+	return (ok);
+}
+
+/**
+ * read_header - Checks the header of a mapped tree file
+ * @map: Pointer to the start of the file
+ * @length: Size of the file in bytes, at least the size of a header
+ * @header: Pointer receiving the header in the host byte order
+ * @swapped: Pointer receiving true if the file uses the other byte order
+ *
+ * Return: true if the file is a complete tree file that can be loaded,
+ * false otherwise
+ */
+static bool read_header(const void *map, size_t length,
+			tree_file_header_t *header, bool *swapped)
+{
+	size_t room;
+
+	memcpy(header, map, sizeof(*header));
+	if (memcmp(header->magic, TREE_FILE_MAGIC, sizeof(header->magic)))
+		return (false);
+
+	*swapped = header->byte_order != TREE_FILE_BYTE_ORDER;
+	if (*swapped)
+	{
+		header->version = __builtin_bswap16(header->version);
+		header->format = __builtin_bswap16(header->format);
+		header->byte_order = __builtin_bswap32(header->byte_order);
+		header->key_size = __builtin_bswap32(header->key_size);
+		header->count = __builtin_bswap64(header->count);
+		header->shape_size = __builtin_bswap64(header->shape_size);
+	}
+	if (header->version != TREE_FILE_VERSION ||
+	    header->byte_order != TREE_FILE_BYTE_ORDER ||
+	    header->key_size != sizeof(int))
+		return (false);
+
+	room = length - sizeof(*header);
+	if (header->format == TREE_FORMAT_SORTED)
+		return (!header->shape_size && header->count == room / sizeof(int) &&
+			room % sizeof(int) == 0);
+	if (header->format != TREE_FORMAT_SHAPE || header->shape_size % 8 ||
+	    header->shape_size > room ||
+	    header->shape_size < (header->count + 1) / 2)
+		return (false);
+	room -= header->shape_size;
+
+	return (header->count == room / sizeof(int) && room % sizeof(int) == 0);
+}
+
+/**
+ * build - Builds the tree held in a mapped tree file
+ * @map: Pointer to the start of the file, whose header was checked
+ * @header: Pointer to the header in the host byte order
+ * @swapped: true if the keys use the other byte order, in which case they
+ * are swapped in place
+ * @tree: Pointer receiving the root node of the tree
+ *
+ * Sorted keys are checked to be strictly increasing before being handed to
+ * sorted_array_to_avl_parallel. A rebuilt shape is freed if it turns out
+ * to be invalid, and gets its cached heights and sizes otherwise.
+ *
+ * Return: true on success, false if the keys or the shape are invalid or
+ * on allocation failure
+ */
+static bool build(void *map, const tree_file_header_t *header,
+		  bool swapped, binary_tree_t **tree)
+{
+	int *keys;
+	size_t i;
+	bool ok = true;
+
+	keys = (int *)((char *)map + sizeof(*header) + header->shape_size);
+	for (i = 0; swapped && i < header->count; i++)
+		keys[i] = (int)__builtin_bswap32((uint32_t)keys[i]);
+	if (!header->count)
+		return (true);
+
+	if (header->format == TREE_FORMAT_SHAPE)
+	{
+		*tree = build_shape((unsigned char *)map + sizeof(*header), keys,
+				    header->count, &ok);
+		if (!ok)
+		{
+			binary_tree_delete(*tree);
+			*tree = NULL;
+			return (false);
+		}
+		refresh(*tree);
+		return (true);
+	}
+
+	for (i = 1; ok && i < header->count; i++)
+		ok = keys[i - 1] < keys[i];
+	if (ok)
+		*tree = sorted_array_to_avl_parallel(keys, header->count, 0);
+
+	return (ok && *tree);
+}
+
+/**
+ * build_shape - Rebuilds a tree from its pre-order shape nibbles and keys
+ * @shape: Pointer to the shape nibbles, two nodes per byte, low nibble first
+ * @keys: Pointer to the keys in pre-order
+ * @count: Number of nodes, at least 1
+ * @ok: Pointer receiving true on success, false if the shape does not
+ * describe exactly @count nodes or on allocation failure, in which case
+ * the nodes built so far are still linked to the returned root
+ *
+ * Each node fills the most recent pending link, then pushes a link for
+ * its right child and one for its left child, so the left subtree is
+ * rebuilt first as pre-order requires.
+ *
+ * Return: Pointer to the root node of the tree, which the caller must free
+ * on failure, or NULL
+ */
+static binary_tree_t *build_shape(const unsigned char *shape,
+				  const int *keys, size_t count, bool *ok)
+{
+	load_slot_t *stack, slot;
+	binary_tree_t *root = NULL, *node;
+	size_t size = 0, i;
+	unsigned char nibble;
+
+	*ok = false;
+	stack = malloc(sizeof(*stack) * (count + 1));
+	if (!stack)
+		return (NULL);
+
+	stack[size].parent = NULL;
+	stack[size++].link = &root;
+	for (i = 0; i < count && size; i++)
+	{
+		slot = stack[--size];
+		node = binary_tree_node(slot.parent, keys[i]);
+		if (!node)
+			break;
+		*slot.link = node;
+
+		nibble = shape[i / 2] >> (i % 2 * 4);
+		node->color = nibble & 4 ? RB_BLACK : RB_RED;
+		if (nibble & 2)
+		{
+			stack[size].parent = node;
+			stack[size++].link = &node->right;
+		}
+		if (nibble & 1)
+		{
+			stack[size].parent = node;
+			stack[size++].link = &node->left;
+		}
+	}
+	*ok = i == count && !size;
+	free(stack);
+
+	return (root);
+}
+
+/**
+ * refresh - Sets the cached height and size of every node of a tree
+ * @tree: Pointer to the root node of the tree
+ *
+ * The nodes are updated in post-order through the parent pointers, so
+ * both children of a node are up to date by the time it is reached.
+ */
+static void refresh(binary_tree_t *tree)
+{
+	binary_tree_t *node, *prev = NULL, *next;
+
+	for (node = tree; node; prev = node, node = next)
+	{
+		if (prev == node->parent && node->left)
+			next = node->left;
+		else if (prev != node->right && node->right)
+			next = node->right;
+		else
+		{
+			avl_update_height(node);
+			bst_update_size(node);
+			next = node->parent;
+		}
+	}
+}
@@ -0,0 +1,83 @@
+#include "binary_trees.h"
+
+/* Frames kept on the stack before a walk allocates */
+#define SUMMARY_SCRATCH_SIZE 64
+/* Level order index of nodes too deep to be numbered */
+#define SUMMARY_NO_INDEX ((size_t)-1)
+
+/**
+ * summary_count - Adds one node to the metrics of a part
+ * @part: Pointer to the part
+ * @node: Pointer to the node
+ * @depth: Depth of the node in the whole tree
+ * @index: Level order index of the node
+ */
+void summary_count(summary_part_t *part, const binary_tree_t *node,
+		   size_t depth, size_t index)
+{
+	part->counts.size++;
+	if (depth > part->counts.height)
+		part->counts.height = depth;
+	if (index > part->max_index)
+		part->max_index = index;
+	if (depth < part->counts.depths_size)
+		part->counts.depths[depth]++;
+
+	if (!node->left && !node->right)
+		part->counts.leaves++;
+	else
+		part->counts.internal++;
+	if (!node->left != !node->right)
+		part->counts.is_full = false;
+}
+
+/**
+ * summary_walk - Counts every node of a subtree into a part
+ * @part: Pointer to the part
+ * @root: Frame of the root of the subtree, whose node may be NULL
+ *
+ * The walk is a pre-order one on an explicit stack that starts on a small
+ * buffer and grows by doubling, so deep trees cannot overflow the call
+ * stack. Indexes past SUMMARY_NO_INDEX saturate.
+ */
+void summary_walk(summary_part_t *part, summary_frame_t root)
+{
+	summary_frame_t scratch[SUMMARY_SCRATCH_SIZE], *stack = scratch, *grown;
+	size_t size = 0, capacity = SUMMARY_SCRATCH_SIZE, i;
+	summary_frame_t frame;
+
+	if (root.node)
+		stack[size++] = root;
+	while (size)
+	{
+		frame = stack[--size];
+		summary_count(part, frame.node, frame.depth, frame.index);
+		if (size + 2 > capacity)
+		{
+			grown = malloc(sizeof(*grown) * capacity * 2);
+			if (!grown)
+			{
+				part->failed = true;
+				break;
+			}
+			memcpy(grown, stack, sizeof(*grown) * size);
+			if (stack != scratch)
+				free(stack);
+			stack = grown;
+			capacity *= 2;
+		}
+		for (i = 2; i-- > 0;)
+		{
+			root.node = i ? frame.node->right : frame.node->left;
+			if (!root.node)
+				continue;
+			root.depth = frame.depth + 1;
+			root.index = frame.index > (SUMMARY_NO_INDEX - 1) / 2 ?
+				     SUMMARY_NO_INDEX : 2 * frame.index + i;
+			stack[size++] = root;
+		}
+	}
+
+	if (stack != scratch)
+		free(stack);
+}
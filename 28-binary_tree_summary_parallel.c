@@ -0,0 +1,205 @@
+#include <pthread.h>
+#include "binary_trees.h"
+
+/* Deepest level at which the tree is split between threads */
+#define SUMMARY_MAX_SPLIT 10
+
+/**
+ * struct summary_worker_s - Share of the parts walked by one thread
+ *
+ * @parts: Pointer to every part
+ * @count: Number of parts
+ * @first: Index of the first part of the share
+ * @stride: Distance between two parts of the share
+ */
+typedef struct summary_worker_s
+{
+	summary_part_t *parts;
+	size_t count;
+	size_t first;
+	size_t stride;
+} summary_worker_t;
+
+static bool share(summary_part_t *top, size_t threads, size_t level);
+static void split(summary_part_t *top, summary_part_t *parts, size_t *count,
+		  summary_frame_t frame, size_t level);
+static void run_threads(summary_part_t *parts, size_t count, size_t threads);
+static void *run_worker(void *arg);
+
+/**
+ * binary_tree_summary_parallel - Measures a binary tree in a single
+ * traversal shared between several threads
+ * @tree: Pointer to the root node of the tree
+ * @summary: Pointer to the summary to fill; @summary->depths and
+ * @summary->depths_size must be set by the caller beforehand
+ * @threads: Number of threads to use, 0 for one per online processor
+ *
+ * The top levels are counted first and the subtrees below them, about
+ * four per thread, are shared out; each keeps its own histogram until the
+ * results are merged. With a single thread, or when the shares cannot be
+ * allocated, the tree is walked as by binary_tree_summary.
+ *
+ * Return: 1 on success, 0 if @summary is NULL or on allocation failure
+ */
+int binary_tree_summary_parallel(const binary_tree_t *tree,
+				 binary_tree_summary_t *summary,
+				 size_t threads)
+{
+	summary_part_t top;
+	size_t level = 0;
+
+	if (!summary)
+		return (0);
+
+	threads = thread_count(threads);
+	while (threads > 1 && ((size_t)1 << level) < 4 * threads &&
+	       level < SUMMARY_MAX_SPLIT)
+		level++;
+
+	summary_part_init(&top, summary->depths, summary->depths_size);
+	top.root.node = tree;
+	if (!tree || !level || !share(&top, threads, level))
+		summary_walk(&top, top.root);
+
+	return (summary_finish(summary, &top));
+}
+
+/**
+ * share - Counts the top levels of a tree and has threads walk the rest
+ * @top: Pointer to the part of the whole tree, with no node counted yet
+ * @threads: Number of threads to use
+ * @level: Depth of the subtrees handed to the threads
+ *
+ * Return: true once every node is counted in @top, false if nothing was
+ * counted because the shares could not be allocated
+ */
+static bool share(summary_part_t *top, size_t threads, size_t level)
+{
+	summary_part_t *parts;
+	size_t count = 0, i;
+
+	parts = calloc((size_t)1 << level, sizeof(*parts));
+	if (!parts)
+		return (false);
+
+	split(top, parts, &count, top->root, level);
+	for (i = 0; i < count; i++)
+	{
+		parts[i].counts.is_full = true;
+		parts[i].counts.depths_size = top->counts.depths_size;
+		if (top->counts.depths_size)
+			parts[i].counts.depths = calloc(top->counts.depths_size,
+							sizeof(size_t));
+		if (top->counts.depths_size && !parts[i].counts.depths)
+			parts[i].failed = true;
+	}
+
+	run_threads(parts, count, threads);
+	for (i = 0; i < count; i++)
+	{
+		summary_merge(top, &parts[i]);
+		free(parts[i].counts.depths);
+	}
+	free(parts);
+
+	return (true);
+}
+
+/**
+ * split - Counts the top levels of a tree and lists the subtrees below them
+ * @top: Pointer to the part receiving the top levels
+ * @parts: Buffer receiving one part per subtree
+ * @count: Pointer to the number of parts listed so far
+ * @frame: Frame of the current node
+ * @level: Depth of the subtrees to list, at most SUMMARY_MAX_SPLIT
+ */
+static void split(summary_part_t *top, summary_part_t *parts, size_t *count,
+		  summary_frame_t frame, size_t level)
+{
+	summary_frame_t child;
+
+	if (!frame.node)
+		return;
+
+	if (frame.depth == level)
+	{
+		parts[(*count)++].root = frame;
+		return;
+	}
+
+	summary_count(top, frame.node, frame.depth, frame.index);
+	child.depth = frame.depth + 1;
+	child.node = frame.node->left;
+	child.index = 2 * frame.index;
+	split(top, parts, count, child, level);
+	child.node = frame.node->right;
+	child.index = 2 * frame.index + 1;
+	split(top, parts, count, child, level);
+}
+
+/**
+ * run_threads - Walks parts on several threads
+ * @parts: Pointer to the parts
+ * @count: Number of parts
+ * @threads: Number of threads to use
+ *
+ * Every share is set up before any thread starts, the first one runs on
+ * the calling thread, and the shares of threads that could not be created
+ * run on the calling thread as well once the others are joined. If the
+ * shares cannot be allocated, every part is walked on the calling thread.
+ */
+static void run_threads(summary_part_t *parts, size_t count, size_t threads)
+{
+	summary_worker_t *workers;
+	pthread_t *ids;
+	size_t n, i, spawned = 1;
+
+	n = threads < count ? threads : count;
+	workers = malloc(sizeof(*workers) * (n ? n : 1));
+	ids = malloc(sizeof(*ids) * (n ? n : 1));
+	for (i = 0; workers && i < n; i++)
+	{
+		workers[i].parts = parts;
+		workers[i].count = count;
+		workers[i].first = i;
+		workers[i].stride = n;
+	}
+	if (!workers || !ids || !n)
+	{
+		for (i = 0; i < count; i++)
+			if (!parts[i].failed)
+				summary_walk(&parts[i], parts[i].root);
+		free(workers);
+		free(ids);
+		return;
+	}
+
+	while (spawned < n &&
+	       !pthread_create(&ids[spawned], NULL, run_worker, &workers[spawned]))
+		spawned++;
+	run_worker(&workers[0]);
+	for (i = 1; i < spawned; i++)
+		pthread_join(ids[i], NULL);
+	for (i = spawned; i < n; i++)
+		run_worker(&workers[i]);
+	free(workers);
+	free(ids);
+}
+
+/**
+ * run_worker - Walks the share of parts of one thread
+ * @arg: Pointer to the summary_worker_t
+ *
+ * Return: Always NULL
+ */
+static void *run_worker(void *arg)
+{
+	summary_worker_t *worker = arg;
+	size_t i;
+
+	for (i = worker->first; i < worker->count; i += worker->stride)
+		if (!worker->parts[i].failed)
+			summary_walk(&worker->parts[i], worker->parts[i].root);
+
+	return (NULL);
+}
@@ -0,0 +1,21 @@
+#include <unistd.h>
+#include "binary_trees.h"
+
+/**
+ * thread_count - Settles the number of threads a parallel operation uses
+ * @threads: Number of threads asked for, 0 for one per online processor
+ *
+ * Return: @threads if it is not 0, the number of online processors
+ * otherwise, or 1 if that number cannot be read
+ */
+size_t thread_count(size_t threads)
+{
+	long online;
+
+	if (threads)
+		return (threads);
+
+	online = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (online > 0 ? (size_t)online : 1);
+}
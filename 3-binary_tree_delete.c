@@ -6,7 +6,7 @@
  *
  * This function deletes an entire binary tree starting from the
  * given root node. It recursively deletes all nodes in the tree
- * and then frees the memory allocated for each node.
+ * and then releases each node with binary_tree_node_free.
  */
 void binary_tree_delete(binary_tree_t *tree)
 {
@@ -20,5 +20,5 @@ void binary_tree_delete(binary_tree_t *tree)
 	tree->right = NULL;
 	tree->parent = NULL;
 
-	free(tree);
+	binary_tree_node_free(tree);
 }
@@ -0,0 +1,72 @@
+#include "binary_trees.h"
+
+/**
+ * node_pool_add_slab - Allocates a new slab and makes it the current one
+ * @pool: Pointer to the pool
+ *
+ * The slab is inserted in @pool->slabs so the array stays sorted by
+ * address, which lets node_pool_owns search it.
+ *
+ * Return: true on success, false on allocation failure
+ */
+bool node_pool_add_slab(node_pool_t *pool)
+{
+	binary_tree_t **slabs, *slab;
+	size_t i;
+
+	slabs = realloc(pool->slabs, sizeof(*slabs) * (pool->slab_count + 1));
+	if (!slabs)
+		return (false);
+	pool->slabs = slabs;
+
+	slab = malloc(sizeof(binary_tree_t) * pool->slab_size);
+	if (!slab)
+		return (false);
+
+	i = pool->slab_count;
+	while (i && (uintptr_t)slabs[i - 1] > (uintptr_t)slab)
+	{
+		slabs[i] = slabs[i - 1];
+		i--;
+	}
+	slabs[i] = slab;
+	pool->slab_count++;
+
+	pool->current = slab;
+	pool->used = 0;
+
+	return (true);
+}
+
+/**
+ * node_pool_owns - Checks whether a node was carved out of a pool
+ * @pool: Pointer to the pool
+ * @node: Pointer to the node to check
+ *
+ * Return: true if @node lies in one of the slabs of @pool, false otherwise
+ */
+bool node_pool_owns(const node_pool_t *pool, const binary_tree_t *node)
+{
+	uintptr_t address = (uintptr_t)node, base;
+	size_t lo = 0, hi, mid;
+
+	if (!pool || !node)
+		return (false);
+
+	hi = pool->slab_count;
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if ((uintptr_t)pool->slabs[mid] <= address)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (!lo)
+		return (false);
+
+	base = (uintptr_t)pool->slabs[lo - 1];
+
+	return (address < base + sizeof(binary_tree_t) * pool->slab_size &&
+		(address - base) % sizeof(binary_tree_t) == 0);
+}
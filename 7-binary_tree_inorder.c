@@ -20,3 +20,21 @@ void binary_tree_inorder(const binary_tree_t *tree, void (*func)(int))
 		func(tree->n);
 	binary_tree_inorder(tree->right, func);
 }
+
+/**
+ * binary_tree_inorder_ctx - Performs a in-order traversal on a binary tree,
+ * with a callback that can stop it
+ * @tree: Pointer to the root node of the tree to traverse
+ * @func: Pointer to the function to call for each node, returning
+ * nonzero to stop the traversal
+ * @ctx: Pointer passed to @func as is
+ *
+ * The walk goes through the parent pointers, see binary_tree_traverse_ctx.
+ *
+ * Return: Number of nodes passed to @func
+ */
+size_t binary_tree_inorder_ctx(const binary_tree_t *tree,
+			       binary_tree_visit_t func, void *ctx)
+{
+	return (binary_tree_traverse_ctx(tree, TRAVERSAL_INORDER, func, ctx));
+}
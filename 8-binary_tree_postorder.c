@@ -21,3 +21,21 @@ void binary_tree_postorder(const binary_tree_t *tree, void (*func)(int))
 	if (func)
 		func(tree->n);
 }
+
+/**
+ * binary_tree_postorder_ctx - Performs a post-order traversal on a binary tree,
+ * with a callback that can stop it
+ * @tree: Pointer to the root node of the tree to traverse
+ * @func: Pointer to the function to call for each node, returning
+ * nonzero to stop the traversal
+ * @ctx: Pointer passed to @func as is
+ *
+ * The walk goes through the parent pointers, see binary_tree_traverse_ctx.
+ *
+ * Return: Number of nodes passed to @func
+ */
+size_t binary_tree_postorder_ctx(const binary_tree_t *tree,
+				 binary_tree_visit_t func, void *ctx)
+{
+	return (binary_tree_traverse_ctx(tree, TRAVERSAL_POSTORDER, func, ctx));
+}
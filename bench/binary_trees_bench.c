@@ -0,0 +1,740 @@
+#include <time.h>
+#include <unistd.h>
+#include "binary_trees.h"
+
+#define TREE_PREFIX int_tree
+#define TREE_KEY_TYPE int
+#define TREE_VALUE_TYPE int
+#include "binary_tree_template.h"
+
+/* Number of keys looked up per bst_search_batch call */
+#define BENCH_BATCH 256
+/* Width of the ranges enumerated with bst_range */
+#define BENCH_RANGE 16
+/* Depths counted in the histogram of binary_tree_summary */
+#define BENCH_DEPTHS 64
+
+/**
+ * struct bench_config_s - Benchmark settings
+ *
+ * @min_size: Smallest number of keys
+ * @max_size: Largest number of keys
+ * @degenerate_cap: Largest number of keys run on inputs that degenerate
+ * an engine into a linked list
+ * @json: true to print JSON lines instead of CSV
+ * @engine: Name of the only engine to run, or NULL to run them all
+ * @threads: Number of threads of the parallel builds and summaries, 0 for all cores
+ */
+typedef struct bench_config_s
+{
+	size_t min_size;
+	size_t max_size;
+	size_t degenerate_cap;
+	bool json;
+	const char *engine;
+	size_t threads;
+} bench_config_t;
+
+/**
+ * struct bench_engine_s - Benchmark entry of a tree engine
+ *
+ * @name: Name of the engine as printed in the results
+ * @degenerates: true if sorted input turns the engine into a linked list
+ * @run: Function measuring every operation of the engine on one input
+ */
+typedef struct bench_engine_s
+{
+	const char *name;
+	bool degenerates;
+	void (*run)(const bench_config_t *config, const char *dist,
+		    int *keys, size_t size);
+} bench_engine_t;
+
+static volatile long sink;
+
+/**
+ * now - Reads a monotonic clock
+ *
+ * Return: The current time in seconds
+ */
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * consume - Traversal callback keeping the visited values alive
+ * @n: Value of the visited node
+ */
+static void consume(int n)
+{
+	sink += n;
+}
+
+/**
+ * visit - Walk callback keeping the visited values alive
+ * @node: Pointer to the visited node
+ * @ctx: Unused
+ *
+ * Return: Always 0, to visit every node
+ */
+static int visit(const binary_tree_t *node, void *ctx)
+{
+	(void)ctx;
+	sink += node->n;
+	return (0);
+}
+
+/**
+ * report - Prints one measurement
+ * @config: Benchmark settings
+ * @engine: Name of the engine
+ * @op: Name of the operation
+ * @dist: Name of the key distribution
+ * @size: Number of keys processed by the operation
+ * @seconds: Elapsed time
+ */
+static void report(const bench_config_t *config, const char *engine,
+		   const char *op, const char *dist, size_t size,
+		   double seconds)
+{
+	double rate = seconds > 0 ? size / seconds : 0;
+
+	if (config->json)
+		printf("{\"engine\":\"%s\",\"operation\":\"%s\","
+		       "\"distribution\":\"%s\",\"size\":%lu,"
+		       "\"seconds\":%.6f,\"ops_per_second\":%.0f}\n",
+		       engine, op, dist, (unsigned long)size, seconds, rate);
+	else
+		printf("%s,%s,%s,%lu,%.6f,%.0f\n", engine, op, dist,
+		       (unsigned long)size, seconds, rate);
+	fflush(stdout);
+}
+
+/**
+ * bench_search_walk - Measures lookups and traversals of a search tree
+ * @config: Benchmark settings
+ * @engine: Name of the engine
+ * @dist: Name of the key distribution
+ * @tree: Pointer to the root node of the tree
+ * @keys: Keys that were inserted
+ * @size: Number of keys
+ */
+static void bench_search_walk(const bench_config_t *config,
+			      const char *engine, const char *dist,
+			      const bst_t *tree, const int *keys, size_t size)
+{
+	bst_t *batch[BENCH_BATCH], *node;
+	size_t depths[BENCH_DEPTHS];
+	binary_tree_summary_t summary;
+	bst_cursor_t cursor;
+	frozen_tree_t *frozen;
+	double start;
+	size_t i;
+
+	start = now();
+	for (i = 0; i < size; i++)
+		sink += bst_search(tree, keys[i]) != NULL;
+	report(config, engine, "search", dist, size, now() - start);
+
+	start = now();
+	for (i = 0; i < size; i += BENCH_BATCH)
+		sink += bst_search_batch(tree, keys + i, size - i < BENCH_BATCH ?
+					 size - i : BENCH_BATCH, batch);
+	report(config, engine, "search_batch", dist, size, now() - start);
+
+	start = now();
+	for (i = 0; i < size; i++)
+		sink += bst_rank(tree, keys[i]);
+	report(config, engine, "rank", dist, size, now() - start);
+
+	start = now();
+	for (i = 0; i < size; i++)
+		sink += bst_select(tree, i) != NULL;
+	report(config, engine, "select", dist, size, now() - start);
+
+	start = now();
+	for (i = 0; i < size; i++)
+		sink += bst_range(tree, keys[i], keys[i] + BENCH_RANGE, visit, NULL);
+	report(config, engine, "range", dist, size, now() - start);
+
+	start = now();
+	frozen = bst_freeze(tree);
+	report(config, engine, "freeze", dist, size, now() - start);
+
+	start = now();
+	for (i = 0; i < size; i++)
+		sink += frozen_tree_search(frozen, keys[i]) != NULL;
+	report(config, engine, "frozen_search", dist, size, now() - start);
+	frozen_tree_delete(frozen);
+
+	start = now();
+	binary_tree_traverse(tree, TRAVERSAL_INORDER, TRAVERSAL_RECURSIVE,
+			     consume);
+	report(config, engine, "inorder_recursive", dist, size, now() - start);
+
+	start = now();
+	binary_tree_traverse(tree, TRAVERSAL_INORDER, TRAVERSAL_PARENT, consume);
+	report(config, engine, "inorder_parent", dist, size, now() - start);
+
+	start = now();
+	binary_tree_traverse(tree, TRAVERSAL_INORDER, TRAVERSAL_MORRIS, consume);
+	report(config, engine, "inorder_morris", dist, size, now() - start);
+
+	start = now();
+	binary_tree_inorder_ctx(tree, visit, NULL);
+	report(config, engine, "inorder_ctx", dist, size, now() - start);
+
+	start = now();
+	bst_cursor_init(&cursor, tree);
+	for (node = bst_cursor_first(&cursor); node;
+	     node = bst_cursor_next(&cursor))
+		sink += node->n;
+	report(config, engine, "cursor_next", dist, size, now() - start);
+
+	start = now();
+	for (node = bst_cursor_last(&cursor); node;
+	     node = bst_cursor_prev(&cursor))
+		sink += node->n;
+	report(config, engine, "cursor_prev", dist, size, now() - start);
+
+	summary.depths = depths;
+	summary.depths_size = BENCH_DEPTHS;
+	start = now();
+	sink += binary_tree_summary(tree, &summary);
+	report(config, engine, "summary", dist, size, now() - start);
+
+	start = now();
+	sink += binary_tree_summary_parallel(tree, &summary, config->threads);
+	report(config, engine, "summary_parallel", dist, size, now() - start);
+
+	start = now();
+	sink += binary_tree_size(tree) + binary_tree_height(tree) +
+		binary_tree_leaves(tree) + binary_tree_nodes(tree) +
+		binary_tree_is_full(tree) + binary_tree_is_complete(tree);
+	report(config, engine, "metrics_separate", dist, size, now() - start);
+}
+
+/**
+ * bench_mixed - Measures a write-heavy mix of operations on a balanced tree
+ * @config: Benchmark settings
+ * @engine: Name of the engine
+ * @dist: Name of the key distribution
+ * @keys: Keys to use
+ * @size: Number of operations
+ * @insert: Insertion function of the engine
+ * @remove: Removal function of the engine
+ *
+ * Operations cycle through 4 insertions, 3 removals and 3 lookups,
+ * so 70% of them modify the tree.
+ */
+static void bench_mixed(const bench_config_t *config, const char *engine,
+			const char *dist, const int *keys, size_t size,
+			binary_tree_t *(*insert)(binary_tree_t **, int),
+			binary_tree_t *(*remove)(binary_tree_t *, int))
+{
+	binary_tree_t *tree = NULL;
+	double start;
+	size_t i;
+
+	start = now();
+	for (i = 0; i < size; i++)
+	{
+		if (i % 10 < 4)
+			insert(&tree, keys[i]);
+		else if (i % 10 < 7)
+			tree = remove(tree, keys[i - 3]);
+		else
+			sink += bst_search(tree, keys[i]) != NULL;
+	}
+	report(config, engine, "mixed", dist, size, now() - start);
+	binary_tree_delete(tree);
+}
+
+/**
+ * bench_bst - Measures the binary search tree
+ * @config: Benchmark settings
+ * @dist: Name of the key distribution
+ * @keys: Keys to use
+ * @size: Number of keys
+ */
+static void bench_bst(const bench_config_t *config, const char *dist,
+		      int *keys, size_t size)
+{
+	bst_t *tree = NULL;
+	double start;
+	size_t i;
+
+	start = now();
+	for (i = 0; i < size; i++)
+		bst_insert(&tree, keys[i]);
+	report(config, "bst", "insert", dist, size, now() - start);
+
+	bench_search_walk(config, "bst", dist, tree, keys, size);
+
+	start = now();
+	sink += binary_tree_is_bst(tree);
+	report(config, "bst", "validate", dist, size, now() - start);
+
+	start = now();
+	for (i = 0; i < size; i++)
+		tree = bst_remove(tree, keys[i]);
+	report(config, "bst", "remove", dist, size, now() - start);
+
+	start = now();
+	tree = array_to_bst(keys, size);
+	report(config, "bst", "build", dist, size, now() - start);
+	binary_tree_delete(tree);
+}
+
+/**
+ * bench_save_load - Measures writing an AVL tree to a file and loading it
+ * @config: Benchmark settings
+ * @dist: Name of the key distribution
+ * @tree: Pointer to the root node of the tree
+ * @size: Number of nodes
+ * @format: Format of the file
+ */
+static void bench_save_load(const bench_config_t *config, const char *dist,
+			    const avl_t *tree, size_t size,
+			    tree_format_t format)
+{
+	char path[] = "/tmp/binary_trees_bench.XXXXXX";
+	binary_tree_t *loaded;
+	FILE *stream;
+	double start;
+	int fd;
+
+	fd = mkstemp(path);
+	if (fd == -1)
+		return;
+	stream = fdopen(fd, "wb");
+	if (!stream)
+	{
+		close(fd);
+		unlink(path);
+		return;
+	}
+
+	start = now();
+	sink += binary_tree_save(tree, stream, format);
+	report(config, "avl", format == TREE_FORMAT_SORTED ? "save_sorted" :
+	       "save_shape", dist, size, now() - start);
+	fclose(stream);
+
+	start = now();
+	sink += binary_tree_load(path, &loaded);
+	report(config, "avl", format == TREE_FORMAT_SORTED ? "load_sorted" :
+	       "load_shape", dist, size, now() - start);
+	binary_tree_delete(loaded);
+	unlink(path);
+}
+
+/**
+ * bench_set_operations - Measures the AVL set operations on two trees
+ * sharing half of their keys
+ * @config: Benchmark settings
+ * @dist: Name of the key distribution
+ * @keys: Keys to use
+ * @size: Number of keys
+ */
+static void bench_set_operations(const bench_config_t *config,
+				 const char *dist, int *keys, size_t size)
+{
+	const char *names[] = {"union", "intersection", "difference"};
+	avl_t *(*ops[])(avl_t *, avl_t *, size_t) = {
+		avl_union, avl_intersection, avl_difference
+	};
+	avl_t *a, *b;
+	double start;
+	size_t i;
+
+	for (i = 0; i < sizeof(ops) / sizeof(*ops); i++)
+	{
+		a = array_to_avl_bulk(keys, size - size / 4);
+		b = array_to_avl_bulk(keys + size / 4, size - size / 4);
+		start = now();
+		a = ops[i](a, b, config->threads);
+		report(config, "avl", names[i], dist, size, now() - start);
+		binary_tree_delete(a);
+	}
+
+	a = array_to_avl_bulk(keys, size - size / 4);
+	start = now();
+	for (i = size / 4; i < size; i++)
+		avl_insert(&a, keys[i]);
+	report(config, "avl", "union_by_insert", dist, size, now() - start);
+	binary_tree_delete(a);
+}
+
+/**
+ * bench_avl - Measures the AVL tree
+ * @config: Benchmark settings
+ * @dist: Name of the key distribution
+ * @keys: Keys to use
+ * @size: Number of keys
+ */
+static void bench_avl(const bench_config_t *config, const char *dist,
+		      int *keys, size_t size)
+{
+	avl_t *tree = NULL, *node, *lo, *hi;
+	double start;
+	size_t i;
+
+	start = now();
+	for (i = 0; i < size; i++)
+		avl_insert(&tree, keys[i]);
+	report(config, "avl", "insert", dist, size, now() - start);
+
+	bench_search_walk(config, "avl", dist, tree, keys, size);
+
+	start = now();
+	sink += binary_tree_is_avl(tree);
+	report(config, "avl", "validate", dist, size, now() - start);
+
+	start = now();
+	for (i = 0; i < size; i++)
+	{
+		node = avl_split(tree, keys[i], &lo, &hi);
+		tree = avl_join(lo, node, hi);
+	}
+	report(config, "avl", "split_join", dist, size, now() - start);
+
+	start = now();
+	for (i = 0; i < size; i++)
+		tree = avl_remove(tree, keys[i]);
+	report(config, "avl", "remove", dist, size, now() - start);
+
+	start = now();
+	tree = array_to_avl(keys, size);
+	report(config, "avl", "build", dist, size, now() - start);
+	binary_tree_delete(tree);
+
+	start = now();
+	tree = array_to_avl_bulk(keys, size);
+	report(config, "avl", "build_bulk", dist, size, now() - start);
+	bench_save_load(config, dist, tree, size, TREE_FORMAT_SORTED);
+	bench_save_load(config, dist, tree, size, TREE_FORMAT_SHAPE);
+	binary_tree_delete(tree);
+	bench_set_operations(config, dist, keys, size);
+
+	if (!strcmp(dist, "sorted"))
+	{
+		start = now();
+		tree = sorted_array_to_avl(keys, size);
+		report(config, "avl", "build_sorted", dist, size, now() - start);
+		binary_tree_delete(tree);
+
+		start = now();
+		tree = sorted_array_to_avl_parallel(keys, size, config->threads);
+		report(config, "avl", "build_parallel", dist, size, now() - start);
+		binary_tree_delete(tree);
+	}
+
+	bench_mixed(config, "avl", dist, keys, size, avl_insert, avl_remove);
+}
+
+/**
+ * bench_rb - Measures the red-black tree
+ * @config: Benchmark settings
+ * @dist: Name of the key distribution
+ * @keys: Keys to use
+ * @size: Number of keys
+ */
+static void bench_rb(const bench_config_t *config, const char *dist,
+		     int *keys, size_t size)
+{
+	rb_t *tree = NULL;
+	double start;
+	size_t i;
+
+	start = now();
+	for (i = 0; i < size; i++)
+		rb_insert(&tree, keys[i]);
+	report(config, "rb", "insert", dist, size, now() - start);
+
+	bench_search_walk(config, "rb", dist, tree, keys, size);
+
+	start = now();
+	sink += binary_tree_is_rb(tree);
+	report(config, "rb", "validate", dist, size, now() - start);
+
+	start = now();
+	for (i = 0; i < size; i++)
+		tree = rb_remove(tree, keys[i]);
+	report(config, "rb", "remove", dist, size, now() - start);
+
+	bench_mixed(config, "rb", dist, keys, size, rb_insert, rb_remove);
+}
+
+/**
+ * bench_heap - Measures the pointer-based max heap
+ * @config: Benchmark settings
+ * @dist: Name of the key distribution
+ * @keys: Keys to use
+ * @size: Number of keys
+ */
+static void bench_heap(const bench_config_t *config, const char *dist,
+		       int *keys, size_t size)
+{
+	heap_handle_t heap = {NULL, 0};
+	size_t i, sorted_size;
+	double start;
+
+	start = now();
+	for (i = 0; i < size; i++)
+		heap_handle_insert(&heap, keys[i]);
+	report(config, "heap", "insert", dist, size, now() - start);
+
+	start = now();
+	binary_tree_levelorder(heap.root, consume);
+	report(config, "heap", "levelorder", dist, size, now() - start);
+
+	start = now();
+	binary_tree_levelorder_ctx(heap.root, visit, NULL);
+	report(config, "heap", "levelorder_ctx", dist, size, now() - start);
+
+	start = now();
+	sink += binary_tree_is_heap(heap.root);
+	report(config, "heap", "validate", dist, size, now() - start);
+
+	start = now();
+	for (i = 0; i < size; i++)
+		sink += heap_handle_extract(&heap);
+	report(config, "heap", "remove", dist, size, now() - start);
+
+	start = now();
+	heap.root = array_to_heap(keys, size);
+	report(config, "heap", "build", dist, size, now() - start);
+
+	start = now();
+	free(heap_to_sorted_array(heap.root, &sorted_size));
+	report(config, "heap", "sort", dist, size, now() - start);
+}
+
+/**
+ * bench_array_heap - Measures the array-backed max heap
+ * @config: Benchmark settings
+ * @dist: Name of the key distribution
+ * @keys: Keys to use
+ * @size: Number of keys
+ */
+static void bench_array_heap(const bench_config_t *config, const char *dist,
+			     int *keys, size_t size)
+{
+	array_heap_t *heap = array_heap_create(0);
+	size_t i, sorted_size;
+	double start;
+
+	start = now();
+	for (i = 0; i < size; i++)
+		array_heap_insert(heap, keys[i]);
+	report(config, "array_heap", "insert", dist, size, now() - start);
+
+	start = now();
+	for (i = 0; i < size; i++)
+		sink += array_heap_extract(heap);
+	report(config, "array_heap", "remove", dist, size, now() - start);
+	array_heap_delete(heap);
+
+	start = now();
+	heap = array_to_array_heap(keys, size);
+	report(config, "array_heap", "build", dist, size, now() - start);
+
+	start = now();
+	free(array_heap_to_sorted_array(heap, &sorted_size));
+	report(config, "array_heap", "sort", dist, size, now() - start);
+	array_heap_delete(heap);
+}
+
+/**
+ * bench_typed - Measures the int instantiation of binary_tree_template.h
+ * @config: Benchmark settings
+ * @dist: Name of the key distribution
+ * @keys: Keys to use
+ * @size: Number of keys
+ *
+ * The operations mirror those of the avl and array_heap engines,
+ * so the generated code can be compared with the int-only one.
+ */
+static void bench_typed(const bench_config_t *config, const char *dist,
+			int *keys, size_t size)
+{
+	int_tree_node_t *tree = NULL;
+	int_tree_heap_t *heap;
+	int_tree_entry_t entry;
+	double start;
+	size_t i;
+
+	start = now();
+	for (i = 0; i < size; i++)
+		int_tree_avl_insert(&tree, keys[i], (int)i);
+	report(config, "typed", "insert", dist, size, now() - start);
+
+	start = now();
+	for (i = 0; i < size; i++)
+		sink += int_tree_search(tree, keys[i]) != NULL;
+	report(config, "typed", "search", dist, size, now() - start);
+
+	start = now();
+	for (i = 0; i < size; i++)
+		tree = int_tree_avl_remove(tree, keys[i]);
+	report(config, "typed", "remove", dist, size, now() - start);
+	int_tree_delete(tree);
+
+	heap = int_tree_heap_create(0);
+	start = now();
+	for (i = 0; i < size; i++)
+		int_tree_heap_insert(heap, keys[i], (int)i);
+	report(config, "typed", "heap_insert", dist, size, now() - start);
+
+	start = now();
+	for (i = 0; i < size; i++)
+		if (int_tree_heap_extract(heap, &entry))
+			sink += entry.key;
+	report(config, "typed", "heap_remove", dist, size, now() - start);
+	int_tree_heap_delete(heap);
+}
+
+static const bench_engine_t engines[] = {
+	{"bst", true, bench_bst},
+	{"avl", false, bench_avl},
+	{"rb", false, bench_rb},
+	{"heap", false, bench_heap},
+	{"array_heap", false, bench_array_heap},
+	{"typed", false, bench_typed}
+};
+
+/**
+ * make_keys - Generates keys following a distribution
+ * @dist: "random", "sorted" or "adversarial"
+ * @size: Number of keys
+ *
+ * Random keys come from a fixed-seed xorshift generator, so runs are
+ * comparable. Adversarial keys alternate between the two ends of the
+ * range, which builds a zigzag list in an unbalanced BST and makes the
+ * balanced engines rotate on almost every insertion.
+ *
+ * Return: Pointer to the keys, or NULL on failure
+ */
+static int *make_keys(const char *dist, size_t size)
+{
+	unsigned int state = 2463534242u;
+	int *keys = malloc(sizeof(int) * size);
+	size_t i;
+
+	if (!keys)
+		return (NULL);
+
+	for (i = 0; i < size; i++)
+	{
+		if (!strcmp(dist, "sorted"))
+			keys[i] = (int)i;
+		else if (!strcmp(dist, "adversarial"))
+			keys[i] = (int)(i % 2 ? size - 1 - i / 2 : i / 2);
+		else
+		{
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			keys[i] = (int)(state % (4 * size));
+		}
+	}
+
+	return (keys);
+}
+
+/**
+ * parse_args - Reads the command line into the benchmark settings
+ * @config: Settings to fill
+ * @argc: Number of arguments
+ * @argv: Arguments
+ *
+ * Return: 0 on success, 1 on usage error
+ */
+static int parse_args(bench_config_t *config, int argc, char **argv)
+{
+	int i;
+
+	config->min_size = 1000;
+	config->max_size = 10000000;
+	config->degenerate_cap = 10000;
+	config->json = false;
+	config->engine = NULL;
+	config->threads = 0;
+
+	for (i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-j"))
+			config->json = true;
+		else if (i + 1 < argc && !strcmp(argv[i], "-n"))
+			config->min_size = strtoul(argv[++i], NULL, 10);
+		else if (i + 1 < argc && !strcmp(argv[i], "-m"))
+			config->max_size = strtoul(argv[++i], NULL, 10);
+		else if (i + 1 < argc && !strcmp(argv[i], "-c"))
+			config->degenerate_cap = strtoul(argv[++i], NULL, 10);
+		else if (i + 1 < argc && !strcmp(argv[i], "-e"))
+			config->engine = argv[++i];
+		else if (i + 1 < argc && !strcmp(argv[i], "-t"))
+			config->threads = strtoul(argv[++i], NULL, 10);
+		else
+			return (1);
+	}
+
+	return (!config->min_size || config->min_size > config->max_size);
+}
+
+/**
+ * main - Runs every engine on every size and key distribution
+ * @argc: Number of arguments
+ * @argv: Arguments
+ *
+ * Usage: binary_trees_bench [-n min] [-m max] [-c cap] [-e engine]
+ *	[-t threads] [-j]
+ * Sizes grow tenfold from min to max. Engines that degenerate on sorted
+ * or adversarial keys are skipped above cap. Results go to stdout as CSV,
+ * or as JSON lines with -j. Parallel builds use -t threads, or every
+ * online processor by default.
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int argc, char **argv)
+{
+	const char *dists[] = {"random", "sorted", "adversarial"};
+	bench_config_t config;
+	size_t size, d, e;
+	int *keys;
+
+	if (parse_args(&config, argc, argv))
+	{
+		fprintf(stderr, "Usage: %s [-n min] [-m max] [-c cap] "
+			"[-e engine] [-t threads] [-j]\n", argv[0]);
+		return (1);
+	}
+
+	if (!config.json)
+		printf("engine,operation,distribution,size,seconds,"
+		       "ops_per_second\n");
+
+	for (size = config.min_size; size <= config.max_size; size *= 10)
+		for (d = 0; d < sizeof(dists) / sizeof(*dists); d++)
+		{
+			keys = make_keys(dists[d], size);
+			if (!keys)
+				return (1);
+			for (e = 0; e < sizeof(engines) / sizeof(*engines); e++)
+			{
+				if (config.engine && strcmp(config.engine, engines[e].name))
+					continue;
+				if (engines[e].degenerates && d && size > config.degenerate_cap)
+					continue;
+				engines[e].run(&config, dists[d], keys, size);
+			}
+			free(keys);
+		}
+
+	return (0);
+}
@@ -0,0 +1,518 @@
+/*
+ * binary_tree_template.h - Generates key/value AVL trees and max heaps
+ * specialized for one key type.
+ *
+ * Define the following macros, then include this file:
+ *
+ *   TREE_PREFIX            Prefix of every generated name, e.g. i64_tree
+ *   TREE_KEY_TYPE          Type of the keys, e.g. long
+ *   TREE_VALUE_TYPE        Type of the values stored next to the keys
+ *   TREE_KEY_COMPARE(a, b) Optional expression comparing two keys, negative,
+ *                          zero or positive like strcmp; numeric comparison
+ *                          is used when it is not defined
+ *
+ * The comparison is expanded in place at every use, so the generated code
+ * has no call through a function pointer on its hot paths. Every function
+ * is static inline: each translation unit gets its own copy, and unused
+ * functions produce no warning. The macros are undefined at the end of the
+ * file, which can be included again for another key type.
+ *
+ * With TREE_PREFIX defined as i64_tree, this file generates:
+ *
+ *   i64_tree_node_t   AVL node holding a key, a value and the cached height
+ *   i64_tree_search, i64_tree_bst_insert, i64_tree_avl_insert,
+ *   i64_tree_avl_remove, i64_tree_delete
+ *   i64_tree_entry_t  Key and value stored in a heap
+ *   i64_tree_heap_t   Array-backed max heap ordered by key
+ *   i64_tree_heap_create, i64_tree_heap_delete, i64_tree_heap_insert,
+ *   i64_tree_heap_extract, i64_tree_heap_peek
+ */
+
+#ifndef _BINARY_TREE_TEMPLATE_H_
+#define _BINARY_TREE_TEMPLATE_H_
+
+#include <stdlib.h>
+#include <stdbool.h>
+
+#define TREE_CAT_(prefix, name) prefix##_##name
+#define TREE_CAT(prefix, name) TREE_CAT_(prefix, name)
+
+#endif /* _BINARY_TREE_TEMPLATE_H_ */
+
+#if !defined(TREE_PREFIX) || !defined(TREE_KEY_TYPE) || \
+	!defined(TREE_VALUE_TYPE)
+#error "TREE_PREFIX, TREE_KEY_TYPE and TREE_VALUE_TYPE must be defined"
+#endif
+
+#ifndef TREE_KEY_COMPARE
+#define TREE_KEY_COMPARE(a, b) (((a) > (b)) - ((a) < (b)))
+#endif
+
+#define TREE_NAME(name) TREE_CAT(TREE_PREFIX, name)
+#define TREE_NODE TREE_NAME(node_t)
+#define TREE_ENTRY TREE_NAME(entry_t)
+#define TREE_HEAP TREE_NAME(heap_t)
+
+/**
+ * struct node_s - AVL node of a generated tree
+ *
+ * @key: Key of the node
+ * @value: Value attached to the key
+ * @height: Cached height of the subtree rooted at the node (leaf is 0)
+ * @parent: Pointer to the parent node
+ * @left: Pointer to the left child node
+ * @right: Pointer to the right child node
+ */
+typedef struct TREE_NAME(node_s)
+{
+	TREE_KEY_TYPE key;
+	TREE_VALUE_TYPE value;
+	int height;
+	struct TREE_NAME(node_s) *parent;
+	struct TREE_NAME(node_s) *left;
+	struct TREE_NAME(node_s) *right;
+} TREE_NODE;
+
+/**
+ * struct entry_s - Key and value stored in a generated heap
+ *
+ * @key: Key ordering the heap
+ * @value: Value attached to the key
+ */
+typedef struct TREE_NAME(entry_s)
+{
+	TREE_KEY_TYPE key;
+	TREE_VALUE_TYPE value;
+} TREE_ENTRY;
+
+/**
+ * struct heap_s - Array-backed max heap of a generated family
+ *
+ * @data: Entries in level order, the children of i are 2i + 1 and 2i + 2
+ * @size: Number of entries in the heap
+ * @capacity: Number of entries @data can hold
+ */
+typedef struct TREE_NAME(heap_s)
+{
+	TREE_ENTRY *data;
+	size_t size;
+	size_t capacity;
+} TREE_HEAP;
+
+/**
+ * search - Searches for a key in a generated tree
+ * @tree: Pointer to the root node of the tree
+ * @key: Key to look for
+ *
+ * Return: Pointer to the node holding @key, or NULL if there is none
+ */
+static inline TREE_NODE *TREE_NAME(search)(const TREE_NODE *tree,
+					   TREE_KEY_TYPE key)
+{
+	int cmp;
+
+	while (tree)
+	{
+		cmp = TREE_KEY_COMPARE(key, tree->key);
+		if (!cmp)
+			return ((TREE_NODE *)tree);
+		tree = cmp < 0 ? tree->left : tree->right;
+	}
+
+	return (NULL);
+}
+
+/**
+ * bst_insert - Inserts a key and its value into a generated tree without
+ * rebalancing it
+ * @tree: Pointer to the root pointer of the tree
+ * @key: Key to insert
+ * @value: Value attached to the key
+ *
+ * Return: Pointer to the new node, or NULL if @key is already present
+ * or on failure
+ */
+static inline TREE_NODE *TREE_NAME(bst_insert)(TREE_NODE **tree,
+					       TREE_KEY_TYPE key,
+					       TREE_VALUE_TYPE value)
+{
+	TREE_NODE *parent = NULL, **link = tree, *node;
+	int cmp;
+
+	if (!tree)
+		return (NULL);
+
+	while (*link)
+	{
+		cmp = TREE_KEY_COMPARE(key, (*link)->key);
+		if (!cmp)
+			return (NULL);
+		parent = *link;
+		link = cmp < 0 ? &parent->left : &parent->right;
+	}
+
+	node = malloc(sizeof(*node));
+	if (!node)
+		return (NULL);
+	node->key = key;
+	node->value = value;
+	node->height = 0;
+	node->parent = parent;
+	node->left = NULL;
+	node->right = NULL;
+	*link = node;
+
+	return (node);
+}
+
+/**
+ * height - Reads the cached height of a generated subtree
+ * @tree: Pointer to the root node of the subtree
+ *
+ * Return: The height stored in @tree, or -1 if @tree is NULL
+ */
+static inline int TREE_NAME(height)(const TREE_NODE *tree)
+{
+	return (tree ? tree->height : -1);
+}
+
+/**
+ * update_height - Recomputes the cached height of a generated node
+ * @tree: Pointer to the node to update
+ */
+static inline void TREE_NAME(update_height)(TREE_NODE *tree)
+{
+	int left = TREE_NAME(height)(tree->left);
+	int right = TREE_NAME(height)(tree->right);
+
+	tree->height = (left > right ? left : right) + 1;
+}
+
+/**
+ * rotate_left - Performs a left rotation on a generated subtree
+ * @tree: Pointer to the root node of the subtree, with a right child
+ *
+ * The parent of @tree is not relinked, as with binary_tree_rotate_left.
+ *
+ * Return: Pointer to the new root node of the subtree
+ */
+static inline TREE_NODE *TREE_NAME(rotate_left)(TREE_NODE *tree)
+{
+	TREE_NODE *pivot = tree->right;
+
+	tree->right = pivot->left;
+	if (pivot->left)
+		pivot->left->parent = tree;
+	pivot->left = tree;
+	pivot->parent = tree->parent;
+	tree->parent = pivot;
+
+	TREE_NAME(update_height)(tree);
+	TREE_NAME(update_height)(pivot);
+
+	return (pivot);
+}
+
+/**
+ * rotate_right - Performs a right rotation on a generated subtree
+ * @tree: Pointer to the root node of the subtree, with a left child
+ *
+ * The parent of @tree is not relinked, as with binary_tree_rotate_right.
+ *
+ * Return: Pointer to the new root node of the subtree
+ */
+static inline TREE_NODE *TREE_NAME(rotate_right)(TREE_NODE *tree)
+{
+	TREE_NODE *pivot = tree->left;
+
+	tree->left = pivot->right;
+	if (pivot->right)
+		pivot->right->parent = tree;
+	pivot->right = tree;
+	pivot->parent = tree->parent;
+	tree->parent = pivot;
+
+	TREE_NAME(update_height)(tree);
+	TREE_NAME(update_height)(pivot);
+
+	return (pivot);
+}
+
+/**
+ * rebalance - Restores the AVL property at a single generated node
+ * @tree: Pointer to the node whose children are already balanced
+ *
+ * Works like avl_rebalance, relinking the parent to the new subtree root.
+ *
+ * Return: Pointer to the root of the rebalanced subtree
+ */
+static inline TREE_NODE *TREE_NAME(rebalance)(TREE_NODE *tree)
+{
+	TREE_NODE *parent = tree->parent, *new_root;
+	int balance;
+
+	TREE_NAME(update_height)(tree);
+	balance = TREE_NAME(height)(tree->left) - TREE_NAME(height)(tree->right);
+	if (balance >= -1 && balance <= 1)
+		return (tree);
+
+	if (balance > 1)
+	{
+		if (TREE_NAME(height)(tree->left->left) <
+		    TREE_NAME(height)(tree->left->right))
+			tree->left = TREE_NAME(rotate_left)(tree->left);
+		new_root = TREE_NAME(rotate_right)(tree);
+	}
+	else
+	{
+		if (TREE_NAME(height)(tree->right->right) <
+		    TREE_NAME(height)(tree->right->left))
+			tree->right = TREE_NAME(rotate_right)(tree->right);
+		new_root = TREE_NAME(rotate_left)(tree);
+	}
+
+	if (parent && parent->left == tree)
+		parent->left = new_root;
+	else if (parent)
+		parent->right = new_root;
+
+	return (new_root);
+}
+
+/**
+ * retrace - Rebalances a generated tree from a modified node up to the root
+ * @node: Pointer to the lowest node whose subtree changed
+ * @root: Pointer to the current root of the tree
+ *
+ * Works like avl_retrace, stopping once a subtree keeps its height.
+ *
+ * Return: Pointer to the root of the tree after rebalancing
+ */
+static inline TREE_NODE *TREE_NAME(retrace)(TREE_NODE *node, TREE_NODE *root)
+{
+	int old_height;
+
+	while (node)
+	{
+		old_height = node->height;
+		node = TREE_NAME(rebalance)(node);
+		if (!node->parent)
+			return (node);
+		if (node->height == old_height)
+			return (root);
+		node = node->parent;
+	}
+
+	return (root);
+}
+
+/**
+ * avl_insert - Inserts a key and its value into a generated AVL tree
+ * @tree: Pointer to the root pointer of the tree
+ * @key: Key to insert
+ * @value: Value attached to the key
+ *
+ * Return: Pointer to the new node, or NULL if @key is already present
+ * or on failure
+ */
+static inline TREE_NODE *TREE_NAME(avl_insert)(TREE_NODE **tree,
+					       TREE_KEY_TYPE key,
+					       TREE_VALUE_TYPE value)
+{
+	TREE_NODE *node = TREE_NAME(bst_insert)(tree, key, value);
+
+	if (node)
+		*tree = TREE_NAME(retrace)(node->parent, *tree);
+
+	return (node);
+}
+
+/**
+ * avl_remove - Removes a key and its value from a generated AVL tree
+ * @root: Pointer to the root node of the tree
+ * @key: Key to remove
+ *
+ * Works like avl_remove: a node with two children takes the key and value
+ * of its in-order successor, which is unlinked instead.
+ *
+ * Return: Pointer to the root of the tree after removal
+ */
+static inline TREE_NODE *TREE_NAME(avl_remove)(TREE_NODE *root,
+					       TREE_KEY_TYPE key)
+{
+	TREE_NODE *node, *child, *parent;
+
+	node = TREE_NAME(search)(root, key);
+	if (!node)
+		return (root);
+
+	if (node->left && node->right)
+	{
+		for (child = node->right; child->left; child = child->left)
+			;
+		node->key = child->key;
+		node->value = child->value;
+		node = child;
+	}
+
+	child = node->left ? node->left : node->right;
+	parent = node->parent;
+	if (child)
+		child->parent = parent;
+	if (!parent)
+		root = child;
+	else if (parent->left == node)
+		parent->left = child;
+	else
+		parent->right = child;
+	free(node);
+
+	return (TREE_NAME(retrace)(parent, root));
+}
+
+/**
+ * delete - Frees every node of a generated tree
+ * @tree: Pointer to the root node of the tree, may be NULL
+ */
+static inline void TREE_NAME(delete)(TREE_NODE *tree)
+{
+	if (!tree)
+		return;
+
+	TREE_NAME(delete)(tree->left);
+	TREE_NAME(delete)(tree->right);
+	free(tree);
+}
+
+/**
+ * heap_create - Creates an empty generated heap
+ * @capacity: Number of entries to reserve, at least 1
+ *
+ * Return: Pointer to the new heap, or NULL on failure
+ */
+static inline TREE_HEAP *TREE_NAME(heap_create)(size_t capacity)
+{
+	TREE_HEAP *heap = malloc(sizeof(*heap));
+
+	if (!heap)
+		return (NULL);
+
+	heap->capacity = capacity ? capacity : 1;
+	heap->size = 0;
+	heap->data = malloc(sizeof(*heap->data) * heap->capacity);
+	if (!heap->data)
+	{
+		free(heap);
+		return (NULL);
+	}
+
+	return (heap);
+}
+
+/**
+ * heap_delete - Frees a generated heap
+ * @heap: Pointer to the heap, may be NULL
+ */
+static inline void TREE_NAME(heap_delete)(TREE_HEAP *heap)
+{
+	if (!heap)
+		return;
+
+	free(heap->data);
+	free(heap);
+}
+
+/**
+ * heap_insert - Inserts a key and its value into a generated heap
+ * @heap: Pointer to the heap
+ * @key: Key ordering the entry
+ * @value: Value attached to the key
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static inline int TREE_NAME(heap_insert)(TREE_HEAP *heap, TREE_KEY_TYPE key,
+					 TREE_VALUE_TYPE value)
+{
+	TREE_ENTRY *data;
+	size_t i, parent, capacity;
+
+	if (!heap)
+		return (0);
+
+	if (heap->size == heap->capacity)
+	{
+		capacity = heap->capacity ? heap->capacity * 2 : 1;
+		data = realloc(heap->data, sizeof(*data) * capacity);
+		if (!data)
+			return (0);
+		heap->data = data;
+		heap->capacity = capacity;
+	}
+
+	for (i = heap->size++; i > 0; i = parent)
+	{
+		parent = (i - 1) / 2;
+		if (TREE_KEY_COMPARE(heap->data[parent].key, key) >= 0)
+			break;
+		heap->data[i] = heap->data[parent];
+	}
+	heap->data[i].key = key;
+	heap->data[i].value = value;
+
+	return (1);
+}
+
+/**
+ * heap_extract - Removes the entry with the largest key of a generated heap
+ * @heap: Pointer to the heap
+ * @entry: Pointer receiving the removed entry
+ *
+ * Return: 1 on success, 0 if the heap is empty
+ */
+static inline int TREE_NAME(heap_extract)(TREE_HEAP *heap, TREE_ENTRY *entry)
+{
+	TREE_ENTRY last;
+	size_t i, child;
+
+	if (!heap || !heap->size || !entry)
+		return (0);
+
+	*entry = heap->data[0];
+	last = heap->data[--heap->size];
+	for (i = 0; (child = 2 * i + 1) < heap->size; i = child)
+	{
+		if (child + 1 < heap->size &&
+		    TREE_KEY_COMPARE(heap->data[child + 1].key,
+				     heap->data[child].key) > 0)
+			child++;
+		if (TREE_KEY_COMPARE(heap->data[child].key, last.key) <= 0)
+			break;
+		heap->data[i] = heap->data[child];
+	}
+	heap->data[i] = last;
+
+	return (1);
+}
+
+/**
+ * heap_peek - Reads the entry with the largest key of a generated heap
+ * @heap: Pointer to the heap
+ *
+ * Return: Pointer to the entry, or NULL if the heap is empty
+ */
+static inline const TREE_ENTRY *TREE_NAME(heap_peek)(const TREE_HEAP *heap)
+{
+	if (!heap || !heap->size)
+		return (NULL);
+
+	return (heap->data);
+}
+
+#undef TREE_NAME
+#undef TREE_NODE
+#undef TREE_ENTRY
+#undef TREE_HEAP
+#undef TREE_KEY_COMPARE
+#undef TREE_PREFIX
+#undef TREE_KEY_TYPE
+#undef TREE_VALUE_TYPE
@@ -5,15 +5,40 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <limits.h>
 #include <math.h>
 
 #define max(a, b) ((a > b) ? a : b)
+#define QUEUE_SCRATCH_SIZE 64
+/* First bytes of a file written by binary_tree_save */
+#define TREE_FILE_MAGIC "BTRE"
+#define TREE_FILE_VERSION 1
+/* Written in native order, reads as 0x04030201 on a host of the other order */
+#define TREE_FILE_BYTE_ORDER 0x01020304
+
+/**
+ * enum rb_color_e - Color of a red-black tree node
+ *
+ * @RB_RED: Red node, new nodes start red
+ * @RB_BLACK: Black node
+ */
+typedef enum rb_color_e
+{
+	RB_RED,
+	RB_BLACK
+} rb_color_t;
 
 /**
  * struct binary_tree_s - Binary tree node
  *
  * @n: Integer stored in the node
+ * @height: Cached height of the subtree rooted at the node (leaf is 0),
+ * maintained by the AVL operations and the rotations
+ * @color: Color of the node, maintained by the red-black operations
+ * @size: Number of nodes in the subtree rooted at the node, maintained by
+ * the BST, AVL and red-black operations and the rotations; 32 bits keep
+ * the node at 40 bytes on 64-bit systems
  * @parent: Pointer to the parent node
  * @left: Pointer to the left child node
  * @right: Pointer to the right child node
@@ -21,44 +46,278 @@
 struct binary_tree_s
 {
 	int n;
+	int height;
+	rb_color_t color;
+	unsigned int size;
 	struct binary_tree_s *parent;
 	struct binary_tree_s *left;
 	struct binary_tree_s *right;
 };
 
 /**
- * struct linked_list_node_s -  Structure representing a node in a linked list.
+ * struct queue_s - Growable circular buffer used as a FIFO queue.
  *
- * @data: Pointer to the data stored in the node.
- * @next: Pointer to the next node in the linked list
- * This structure contains a pointer to the data stored in the node
- * and a pointer to the next node in the linked list.
+ * @buffer: Slots of the queue.
+ * @capacity: Number of slots in @buffer.
+ * @head: Index of the first element in @buffer.
+ * @size: Number of elements in the queue.
+ * @owned: true if @buffer was allocated by the queue and must be freed.
+ * The queue can start on a caller-provided scratch buffer and only
+ * allocates when it outgrows it, doubling its capacity each time.
  */
-typedef struct linked_list_node_s
+typedef struct queue_s
 {
-	void *data;
-	struct linked_list_node_s *next;
-} linked_list_node_t;
+	void **buffer;
+	size_t capacity;
+	size_t head;
+	size_t size;
+	bool owned;
+} queue_t;
 
 /**
- * struct queue_s - Structure representing a queue.
- * @head: Pointer to the first element in the queue.
- * @tail: Pointer to the last element in the queue.
- * This structure contains pointers to the head and tail of the queue.
+ * enum traversal_order_e - Order in which a traversal visits the nodes
+ *
+ * @TRAVERSAL_PREORDER: Node, then left subtree, then right subtree
+ * @TRAVERSAL_INORDER: Left subtree, then node, then right subtree
+ * @TRAVERSAL_POSTORDER: Left subtree, then right subtree, then node
  */
-typedef struct queue_s
+typedef enum traversal_order_e
 {
-	linked_list_node_t *head;
-	linked_list_node_t *tail;
-} queue_t;
+	TRAVERSAL_PREORDER,
+	TRAVERSAL_INORDER,
+	TRAVERSAL_POSTORDER
+} traversal_order_t;
+
+/**
+ * enum traversal_mode_e - Strategy used to walk a binary tree
+ *
+ * @TRAVERSAL_RECURSIVE: Plain recursion, one stack frame per level
+ * @TRAVERSAL_PARENT: Iterative walk through the parent pointers, O(1) space
+ * @TRAVERSAL_MORRIS: Morris threading, O(1) space without parent pointers
+ */
+typedef enum traversal_mode_e
+{
+	TRAVERSAL_RECURSIVE,
+	TRAVERSAL_PARENT,
+	TRAVERSAL_MORRIS
+} traversal_mode_t;
+
+/**
+ * enum tree_format_e - Layout of the nodes in a tree file
+ *
+ * @TREE_FORMAT_SORTED: Keys in increasing order, for BST and AVL trees;
+ * loading builds a balanced AVL tree from them
+ * @TREE_FORMAT_SHAPE: One shape nibble per node in pre-order, bit 0 set
+ * when the node has a left child, bit 1 when it has a right child and bit 2
+ * when it is black, then the keys in pre-order; loading restores the exact
+ * tree, so it suits any binary tree
+ */
+typedef enum tree_format_e
+{
+	TREE_FORMAT_SORTED,
+	TREE_FORMAT_SHAPE
+} tree_format_t;
+
+/**
+ * enum avl_set_op_e - Set operation combining two AVL trees
+ *
+ * @AVL_SET_UNION: Keys of either tree
+ * @AVL_SET_INTERSECTION: Keys of both trees
+ * @AVL_SET_DIFFERENCE: Keys of the first tree that are not in the second one
+ */
+typedef enum avl_set_op_e
+{
+	AVL_SET_UNION,
+	AVL_SET_INTERSECTION,
+	AVL_SET_DIFFERENCE
+} avl_set_op_t;
+
+/**
+ * struct tree_file_header_s - Header at the start of a tree file
+ *
+ * @magic: TREE_FILE_MAGIC, without its terminating null byte
+ * @version: TREE_FILE_VERSION of the writer
+ * @format: tree_format_t of the file
+ * @byte_order: TREE_FILE_BYTE_ORDER in the byte order of the writer, which
+ * every other field and key uses as well
+ * @key_size: Size in bytes of each key
+ * @count: Number of nodes
+ * @shape_size: Size in bytes of the shape nibbles, padded to a multiple of
+ * 8 so the keys stay aligned, 0 for TREE_FORMAT_SORTED
+ * The header is followed by the shape nibbles, then the packed keys.
+ */
+typedef struct tree_file_header_s
+{
+	char magic[4];
+	uint16_t version;
+	uint16_t format;
+	uint32_t byte_order;
+	uint32_t key_size;
+	uint64_t count;
+	uint64_t shape_size;
+} tree_file_header_t;
 
 typedef struct binary_tree_s binary_tree_t;
 typedef struct binary_tree_s bst_t;
 typedef struct binary_tree_s avl_t;
 typedef struct binary_tree_s heap_t;
+typedef struct binary_tree_s rb_t;
+
+/**
+ * binary_tree_visit_t - Callback receiving the nodes of a walk
+ *
+ * The callback gets the visited node and the context pointer given to the
+ * walk, and returns 0 to carry on or any other value to stop the walk.
+ */
+typedef int (*binary_tree_visit_t)(const binary_tree_t *node, void *ctx);
+
+/**
+ * struct bst_cursor_s - Position in the in-order sequence of a BST
+ *
+ * @root: Pointer to the root node of the BST
+ * @node: Pointer to the node under the cursor, or NULL if there is none
+ */
+typedef struct bst_cursor_s
+{
+	const bst_t *root;
+	const bst_t *node;
+} bst_cursor_t;
+
+/**
+ * struct binary_tree_summary_s - Metrics of a binary tree gathered together
+ *
+ * @size: Number of nodes
+ * @height: Height of the tree, 0 for an empty tree or a single node
+ * @leaves: Number of nodes without children
+ * @internal: Number of nodes with at least one child
+ * @is_full: true if every node has either 0 or 2 children
+ * @is_perfect: true if every level of the tree is filled
+ * @is_complete: true if every level but the last is filled and the last
+ * one is filled from the left
+ * @depths: Caller buffer receiving the number of nodes at each depth, or
+ * NULL to skip the histogram
+ * @depths_size: Number of entries in @depths, deeper nodes are not counted
+ */
+typedef struct binary_tree_summary_s
+{
+	size_t size;
+	size_t height;
+	size_t leaves;
+	size_t internal;
+	bool is_full;
+	bool is_perfect;
+	bool is_complete;
+	size_t *depths;
+	size_t depths_size;
+} binary_tree_summary_t;
+
+/**
+ * struct summary_frame_s - Node waiting in a summary walk
+ *
+ * @node: Pointer to the node
+ * @depth: Depth of the node in the whole tree
+ * @index: Level order index of the node, starting from 1 at the root
+ */
+typedef struct summary_frame_s
+{
+	const binary_tree_t *node;
+	size_t depth;
+	size_t index;
+} summary_frame_t;
+
+/**
+ * struct summary_part_s - Metrics gathered over part of a tree
+ *
+ * @counts: Node, leaf and internal counts, deepest depth in @counts.height,
+ * whether every node has 0 or 2 children, and the depth histogram
+ * @max_index: Largest level order index met
+ * @root: Frame of the subtree to walk, for the parts given to threads
+ * @failed: true if the walk ran out of memory
+ */
+typedef struct summary_part_s
+{
+	binary_tree_summary_t counts;
+	size_t max_index;
+	summary_frame_t root;
+	bool failed;
+} summary_part_t;
+
+/**
+ * struct node_pool_s - Slab allocator for binary tree nodes
+ *
+ * @slabs: Every slab of the pool, sorted by address
+ * @slab_count: Number of slabs in @slabs
+ * @current: Most recent slab, which new nodes are carved out of
+ * @free_list: Released nodes waiting for reuse, chained through @parent
+ * @slab_size: Number of nodes carved out of each slab
+ * @used: Number of nodes already carved out of @current
+ *
+ * A node belongs to the pool whose slabs contain it, and must be released
+ * while that pool is the active one of the releasing thread.
+ */
+typedef struct node_pool_s
+{
+	binary_tree_t **slabs;
+	size_t slab_count;
+	binary_tree_t *current;
+	binary_tree_t *free_list;
+	size_t slab_size;
+	size_t used;
+} node_pool_t;
+
+/**
+ * struct frozen_tree_s - Read-only copy of a BST laid out for searching
+ *
+ * @keys: Keys in Eytzinger order, the children of keys[i] are keys[2i] and
+ * keys[2i + 1], keys[0] is unused and keys[1] is the root
+ * @size: Number of keys
+ */
+typedef struct frozen_tree_s
+{
+	int *keys;
+	size_t size;
+} frozen_tree_t;
+
+/**
+ * struct heap_handle_s - Max heap together with its element count
+ *
+ * @root: Pointer to the root node of the heap
+ * @size: Number of nodes in the heap
+ * Keeping the count next to the root lets the insertion slot and the
+ * last node be located from the bits of the count, without a size walk.
+ */
+typedef struct heap_handle_s
+{
+	heap_t *root;
+	size_t size;
+} heap_handle_t;
+
+/**
+ * struct array_heap_s - Max heap stored in a contiguous array
+ *
+ * @data: Array of values, the children of index i are at 2i + 1 and 2i + 2
+ * @size: Number of values in the heap
+ * @capacity: Number of values @data can hold before growing
+ */
+typedef struct array_heap_s
+{
+	int *data;
+	size_t size;
+	size_t capacity;
+} array_heap_t;
 
 void binary_tree_print(const binary_tree_t *);
 binary_tree_t *binary_tree_node(binary_tree_t *parent, int value);
+void binary_tree_node_free(binary_tree_t *node);
+node_pool_t *node_pool_create(size_t slab_size);
+binary_tree_t *node_pool_alloc(node_pool_t *pool);
+void node_pool_release(node_pool_t *pool, binary_tree_t *node);
+void node_pool_reset(node_pool_t *pool);
+void node_pool_destroy(node_pool_t *pool);
+bool node_pool_add_slab(node_pool_t *pool);
+bool node_pool_owns(const node_pool_t *pool, const binary_tree_t *node);
+void node_pool_use(node_pool_t *pool);
+node_pool_t *node_pool_active(void);
 binary_tree_t *binary_tree_insert_left(binary_tree_t *parent, int value);
 binary_tree_t *binary_tree_insert_right(binary_tree_t *parent, int value);
 void binary_tree_delete(binary_tree_t *tree);
@@ -67,6 +326,23 @@ int binary_tree_is_root(const binary_tree_t *node);
 void binary_tree_preorder(const binary_tree_t *tree, void (*func)(int));
 void binary_tree_inorder(const binary_tree_t *tree, void (*func)(int));
 void binary_tree_postorder(const binary_tree_t *tree, void (*func)(int));
+void binary_tree_traverse(const binary_tree_t *tree, traversal_order_t order,
+			  traversal_mode_t mode, void (*func)(int));
+void binary_tree_traverse_parent(const binary_tree_t *tree,
+				 traversal_order_t order, void (*func)(int));
+void binary_tree_traverse_morris(const binary_tree_t *tree,
+				 traversal_order_t order, void (*func)(int));
+size_t binary_tree_traverse_ctx(const binary_tree_t *tree,
+				traversal_order_t order,
+				binary_tree_visit_t func, void *ctx);
+size_t binary_tree_preorder_ctx(const binary_tree_t *tree,
+				binary_tree_visit_t func, void *ctx);
+size_t binary_tree_inorder_ctx(const binary_tree_t *tree,
+			       binary_tree_visit_t func, void *ctx);
+size_t binary_tree_postorder_ctx(const binary_tree_t *tree,
+				 binary_tree_visit_t func, void *ctx);
+size_t binary_tree_levelorder_ctx(const binary_tree_t *tree,
+				  binary_tree_visit_t func, void *ctx);
 size_t binary_tree_height(const binary_tree_t *tree);
 size_t binary_tree_depth(const binary_tree_t *tree);
 size_t binary_tree_size(const binary_tree_t *tree);
@@ -75,28 +351,114 @@ size_t binary_tree_nodes(const binary_tree_t *tree);
 int binary_tree_balance(const binary_tree_t *tree);
 int binary_tree_is_full(const binary_tree_t *tree);
 int binary_tree_is_perfect(const binary_tree_t *tree);
+int binary_tree_summary(const binary_tree_t *tree,
+			binary_tree_summary_t *summary);
+int binary_tree_summary_parallel(const binary_tree_t *tree,
+				 binary_tree_summary_t *summary,
+				 size_t threads);
+void summary_part_init(summary_part_t *part, size_t *depths,
+		       size_t depths_size);
+void summary_count(summary_part_t *part, const binary_tree_t *node,
+		   size_t depth, size_t index);
+void summary_walk(summary_part_t *part, summary_frame_t root);
+void summary_merge(summary_part_t *top, const summary_part_t *part);
+int summary_finish(binary_tree_summary_t *summary, const summary_part_t *part);
+int binary_tree_save(const binary_tree_t *tree, FILE *stream,
+		     tree_format_t format);
+int binary_tree_load(const char *path, binary_tree_t **tree);
 binary_tree_t *binary_tree_sibling(binary_tree_t *node);
 binary_tree_t *binary_tree_uncle(binary_tree_t *node);
 binary_tree_t *binary_trees_ancestor(const binary_tree_t *first,
 				     const binary_tree_t *second);
+void queue_init(queue_t *queue, void **scratch, size_t capacity);
+bool queue_push(queue_t *queue, void *data);
+void *queue_pop(queue_t *queue);
+bool queue_is_empty(const queue_t *queue);
+void queue_free(queue_t *queue);
 void binary_tree_levelorder(const binary_tree_t *tree, void (*func)(int));
 int binary_tree_is_complete(const binary_tree_t *tree);
 binary_tree_t *binary_tree_rotate_left(binary_tree_t *tree);
 binary_tree_t *binary_tree_rotate_right(binary_tree_t *tree);
 int binary_tree_is_bst(const binary_tree_t *tree);
 bst_t *bst_insert(bst_t **tree, int value);
+bst_t *bst_insert_or_get(bst_t **tree, int value, bool *inserted);
 bst_t *array_to_bst(int *array, size_t size);
 bst_t *bst_search(const bst_t *tree, int value);
+bst_t *bst_select(const bst_t *tree, size_t k);
+size_t bst_rank(const bst_t *tree, int value);
+size_t bst_count_range(const bst_t *tree, int lo, int hi);
+size_t bst_size(const bst_t *tree);
+bst_t *bst_lower_bound(const bst_t *tree, int value);
+bst_t *bst_successor(const bst_t *node);
+bst_t *bst_predecessor(const bst_t *node);
+void bst_cursor_init(bst_cursor_t *cursor, const bst_t *tree);
+bst_t *bst_cursor_first(bst_cursor_t *cursor);
+bst_t *bst_cursor_last(bst_cursor_t *cursor);
+bst_t *bst_cursor_seek(bst_cursor_t *cursor, int value);
+bst_t *bst_cursor_next(bst_cursor_t *cursor);
+bst_t *bst_cursor_prev(bst_cursor_t *cursor);
+size_t bst_range(const bst_t *tree, int lo, int hi,
+		 binary_tree_visit_t func, void *ctx);
+size_t bst_range_page(const bst_t *tree, int lo, int hi, int *buffer,
+		      size_t limit);
+void bst_update_size(bst_t *tree);
+size_t bst_search_batch(const bst_t *tree, const int *keys, size_t count,
+			bst_t **out);
 bst_t *bst_remove(bst_t *root, int value);
 int binary_tree_is_avl(const binary_tree_t *tree);
+int binary_tree_check_avl(const binary_tree_t *tree, const binary_tree_t **bad);
 avl_t *avl_insert(avl_t **tree, int value);
 avl_t *array_to_avl(int *array, size_t size);
+avl_t *array_to_avl_bulk(int *array, size_t size);
 bst_t *avl_remove(bst_t *root, int value);
 avl_t *sorted_array_to_avl(int *array, size_t size);
+avl_t *sorted_array_to_avl_parallel(int *array, size_t size, size_t threads);
+size_t thread_count(size_t threads);
+frozen_tree_t *bst_freeze(const bst_t *tree);
+void frozen_tree_delete(frozen_tree_t *frozen);
+const int *frozen_tree_lower_bound(const frozen_tree_t *frozen, int value);
+const int *frozen_tree_search(const frozen_tree_t *frozen, int value);
+int avl_height(const avl_t *tree);
+void avl_update_height(avl_t *tree);
+avl_t *avl_rebalance(avl_t *tree);
+avl_t *avl_retrace(avl_t *node, avl_t *root);
+avl_t *avl_join(avl_t *lo, avl_t *pivot, avl_t *hi);
+avl_t *avl_concat(avl_t *lo, avl_t *hi);
+avl_t *avl_split(avl_t *tree, int key, avl_t **lo, avl_t **hi);
+avl_t *avl_union(avl_t *a, avl_t *b, size_t threads);
+avl_t *avl_intersection(avl_t *a, avl_t *b, size_t threads);
+avl_t *avl_difference(avl_t *a, avl_t *b, size_t threads);
+avl_t *avl_set_combine(avl_set_op_t op, avl_t *a, avl_t *b, size_t threads);
+rb_t *rb_insert(rb_t **tree, int value);
+rb_t *rb_remove(rb_t *root, int value);
+rb_t *rb_search(const rb_t *tree, int value);
+rb_t *rb_child(const rb_t *node, int dir);
+void rb_rotate(rb_t **root, rb_t *node, int dir);
+int binary_tree_is_rb(const binary_tree_t *tree);
 heap_t *heap_insert(heap_t **root, int value);
 int binary_tree_is_heap(const binary_tree_t *tree);
+int binary_tree_check_heap(const binary_tree_t *tree,
+			   const binary_tree_t **bad);
 heap_t *array_to_heap(int *array, size_t size);
 int heap_extract(heap_t **root);
 int *heap_to_sorted_array(heap_t *heap, size_t *size);
+int *heap_to_sorted_buffer(heap_t *heap, int *buffer, size_t capacity,
+			   size_t *size, bool destroy);
+void heap_flatten(heap_t *tree, int *array, size_t index, bool destroy);
+heap_t *heap_node_at(const heap_t *root, size_t index);
+heap_t *heap_handle_insert(heap_handle_t *heap, int value);
+int heap_handle_extract(heap_handle_t *heap);
+array_heap_t *array_heap_create(size_t capacity);
+void array_heap_delete(array_heap_t *heap);
+int array_heap_insert(array_heap_t *heap, int value);
+int array_heap_extract(array_heap_t *heap);
+int array_heap_peek(const array_heap_t *heap);
+void array_heap_sift_down(int *array, size_t size, size_t index);
+void array_heapify(int *array, size_t size);
+void array_heap_sort(int *array, size_t size);
+array_heap_t *array_to_array_heap(int *array, size_t size);
+int *array_heap_to_sorted_array(array_heap_t *heap, size_t *size);
+array_heap_t *heap_to_array_heap(const heap_t *heap);
+heap_t *array_heap_to_heap(const array_heap_t *heap);
 
 #endif /* _BINARY_TREES_H_ */